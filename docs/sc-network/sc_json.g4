@@ -22,6 +22,7 @@ sc_json_command_type_and_payload
   | sc_json_command_handle_link_contents
   | sc_json_command_search_template
   | sc_json_command_generate_template
+  | sc_json_command_search_neighbours
   | sc_json_command_handle_events
   | sc_json_command_answer_init_event
   ;
@@ -44,6 +45,7 @@ sc_json_command_answer_payload
   | sc_json_command_answer_handle_link_contents
   | sc_json_command_answer_search_template
   | sc_json_command_answer_generate_template
+  | sc_json_command_answer_search_neighbours
   | sc_json_command_answer_handle_events
   ;
 
@@ -330,6 +332,35 @@ sc_json_command_answer_generate_template
     '}' ','
   ;
 
+sc_json_command_search_neighbours
+  : '"type"' ':' '"search_neighbours"' ','
+    '"payload"' ':'
+    '{'
+        '"addr"' ':' SC_ADDR_HASH ','
+        ('"direction"' ':' ('"output"' | '"input"') ',')?
+        ('"edgeType"' ':' SC_EDGE_TYPE ',')?
+        '"count"' ':' NUMBER ','
+        ('"reverse"' ':' BOOL ',')?
+        ('"cursor"' ':' sc_json_neighbours_cursor ',')?
+    '}' ','
+  ;
+
+sc_json_neighbours_cursor
+  : '[' SC_ADDR_HASH ',' SC_ADDR_HASH ',' SC_ADDR_HASH ']'
+  | 'null'
+  ;
+
+sc_json_command_answer_search_neighbours
+  : '"payload"' ':'
+    '{'
+        '"triples"' ':'
+        '['
+            ('[' SC_ADDR_HASH ',' SC_ADDR_HASH ',' SC_ADDR_HASH ']' ',')*
+        ']' ','
+        '"cursor"' ':' sc_json_neighbours_cursor ','
+    '}' ','
+  ;
+
 sc_json_command_handle_events
   : '"type"' ':' '"events"' ','
     '"payload"' ':'
@@ -19,6 +19,7 @@ void search_translation(sc_addr elem, sc_addr answer, sc_bool sys_off)
 {
   sc_iterator5 * it5;
   sc_iterator3 *it3, *it4;
+  sc_iterator3 it3_storage, it4_storage;
   sc_bool found = SC_FALSE;
 
   // iterate translations of sc-element
@@ -44,7 +45,8 @@ void search_translation(sc_addr elem, sc_addr answer, sc_bool sys_off)
     appendIntoAnswer(answer, sc_iterator5_value(it5, 3));
 
     // iterate translation sc-links
-    it3 = sc_iterator3_f_a_a_new(s_default_ctx, sc_iterator5_value(it5, 0), sc_type_arc_pos_const_perm, 0);
+    it3 = sc_iterator3_f_a_a_init(
+        &it3_storage, s_default_ctx, sc_iterator5_value(it5, 0), sc_type_arc_pos_const_perm, 0);
     while (sc_iterator3_next(it3) == SC_TRUE)
     {
       if (sys_off == SC_TRUE &&
@@ -52,7 +54,8 @@ void search_translation(sc_addr elem, sc_addr answer, sc_bool sys_off)
         continue;
 
       // iterate input arcs for link
-      it4 = sc_iterator3_a_a_f_new(s_default_ctx, sc_type_node, sc_type_arc_pos_const_perm, sc_iterator3_value(it3, 2));
+      it4 = sc_iterator3_a_a_f_init(
+          &it4_storage, s_default_ctx, sc_type_node, sc_type_arc_pos_const_perm, sc_iterator3_value(it3, 2));
       while (sc_iterator3_next(it4) == SC_TRUE)
       {
         if (sys_off == SC_TRUE &&
@@ -65,10 +68,11 @@ void search_translation(sc_addr elem, sc_addr answer, sc_bool sys_off)
           appendIntoAnswer(answer, sc_iterator3_value(it4, 1));
         }
       }
-      sc_iterator3_free(it4);
+      sc_iterator3_destroy(it4);
 
       // iterate input arcs for arc
-      it4 = sc_iterator3_a_a_f_new(s_default_ctx, sc_type_node, sc_type_arc_pos_const_perm, sc_iterator3_value(it3, 1));
+      it4 = sc_iterator3_a_a_f_init(
+          &it4_storage, s_default_ctx, sc_type_node, sc_type_arc_pos_const_perm, sc_iterator3_value(it3, 1));
       while (sc_iterator3_next(it4) == SC_TRUE)
       {
         if (sys_off == SC_TRUE &&
@@ -78,12 +82,12 @@ void search_translation(sc_addr elem, sc_addr answer, sc_bool sys_off)
         appendIntoAnswer(answer, sc_iterator3_value(it4, 0));
         appendIntoAnswer(answer, sc_iterator3_value(it4, 1));
       }
-      sc_iterator3_free(it4);
+      sc_iterator3_destroy(it4);
 
       appendIntoAnswer(answer, sc_iterator3_value(it3, 1));
       appendIntoAnswer(answer, sc_iterator3_value(it3, 2));
     }
-    sc_iterator3_free(it3);
+    sc_iterator3_destroy(it3);
   }
   sc_iterator5_free(it5);
 
@@ -174,6 +178,8 @@ void search_typical_sc_neighborhood(sc_addr elem, sc_addr answer, sc_bool sys_of
   sc_iterator3 *it1, *it0;
   sc_iterator5 * it5;
   sc_bool found = SC_FALSE;
+  sc_addr results[SC_ITERATOR_BATCH_SIZE * 3];
+  sc_uint32 count, i;
 
   // search for keynode_typical_sc_neighborhood
   it0 = sc_iterator3_a_a_f_new(s_default_ctx, sc_type_node | sc_type_const, sc_type_arc_pos_const_perm, elem);
@@ -184,14 +190,17 @@ void search_typical_sc_neighborhood(sc_addr elem, sc_addr answer, sc_bool sys_of
       found = SC_TRUE;
       // iterate input arcs for elem
       it1 = sc_iterator3_f_a_a_new(s_default_ctx, elem, sc_type_arc_pos_const_perm, 0);
-      while (sc_iterator3_next(it1) == SC_TRUE)
+      while ((count = sc_iterator3_next_batch(it1, results, SC_ITERATOR_BATCH_SIZE)) > 0)
       {
-        if (sys_off == SC_TRUE &&
-            (IS_SYSTEM_ELEMENT(sc_iterator3_value(it1, 1)) || IS_SYSTEM_ELEMENT(sc_iterator3_value(it1, 2))))
-          continue;
+        for (i = 0; i < count; ++i)
+        {
+          sc_addr const * triple = results + i * 3;
+          if (sys_off == SC_TRUE && (IS_SYSTEM_ELEMENT(triple[1]) || IS_SYSTEM_ELEMENT(triple[2])))
+            continue;
 
-        appendIntoAnswer(answer, sc_iterator3_value(it1, 1));
-        appendIntoAnswer(answer, sc_iterator3_value(it1, 2));
+          appendIntoAnswer(answer, triple[1]);
+          appendIntoAnswer(answer, triple[2]);
+        }
       }
       sc_iterator3_free(it1);
 
@@ -75,15 +75,20 @@ void uiSc2SCnJsonTranslator::runImpl()
       if (SC_ADDR_IS_EQUAL(mInputConstructionAddr, keyword))
       {
         sc_iterator3 * keywordEdgesIt3 = sc_iterator3_f_a_a_new(s_default_ctx, keyword, sc_type_arc_pos_const_perm, 0);
-        while (sc_iterator3_next(keywordEdgesIt3))
+        sc_addr results[SC_ITERATOR_BATCH_SIZE * 3];
+        sc_uint32 count;
+        while ((count = sc_iterator3_next_batch(keywordEdgesIt3, results, SC_ITERATOR_BATCH_SIZE)) > 0)
         {
-          sc_addr const edge = sc_iterator3_value(keywordEdgesIt3, 1);
-          sc_type type;
-          if (sc_memory_get_element_type(s_default_ctx, edge, &type) != SC_RESULT_OK)
-            continue;
-
-          if (mEdges.count(edge) == 0)
-            mEdges.insert({edge, type});
+          for (sc_uint32 i = 0; i < count; ++i)
+          {
+            sc_addr const edge = results[i * 3 + 1];
+            sc_type type;
+            if (sc_memory_get_element_type(s_default_ctx, edge, &type) != SC_RESULT_OK)
+              continue;
+
+            if (mEdges.count(edge) == 0)
+              mEdges.insert({edge, type});
+          }
         }
       }
     }
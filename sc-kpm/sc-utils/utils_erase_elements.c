@@ -10,6 +10,7 @@
 #include "utils_keynodes.h"
 #include "../sc-search/search_keynodes.h"
 #include "../sc-search/search_utils.h"
+#include "sc-core/sc-store/sc-base/sc_allocator.h"
 #include "sc-core/sc-store/sc-base/sc_message.h"
 /*!
  *  Erase sc-elements from memory if they dont belong to init memory structure
@@ -49,6 +50,12 @@ sc_result agent_erase_elements(const sc_event * event, sc_addr arg)
   sc_addr set_addr = sc_iterator5_value(get_set_it, 2);
   sc_iterator5_free(get_set_it);
 
+  // elements are erased together after iteration, so their shared neighbours are locked once
+  sc_addr * erase_addrs = null_ptr;
+  sc_uint32 erase_count = 0;
+  sc_uint32 erase_capacity = 0;
+  sc_uint32 i;
+
   sc_iterator3 * set_it = sc_iterator3_f_a_a_new(s_erase_elements_ctx, set_addr, 0, 0);
   while (sc_iterator3_next(set_it) == SC_TRUE)
   {
@@ -57,6 +64,7 @@ sc_result agent_erase_elements(const sc_event * event, sc_addr arg)
     if (SC_ADDR_IS_EQUAL(element_addr, question_addr))
     {
       sc_iterator3_free(set_it);
+      sc_mem_free(erase_addrs);
       finish_question_unsuccessfully(s_erase_elements_ctx, question_addr);
       return SC_RESULT_ERROR;
     }
@@ -82,10 +90,25 @@ sc_result agent_erase_elements(const sc_event * event, sc_addr arg)
       }
     }
 
-    sc_memory_element_free(s_erase_elements_ctx, element_addr);
+    if (erase_count == erase_capacity)
+    {
+      erase_capacity = erase_capacity == 0 ? 64 : erase_capacity * 2;
+      erase_addrs = sc_mem_renew(erase_addrs, sc_addr, erase_capacity);
+    }
+    erase_addrs[erase_count++] = element_addr;
   }
 
   sc_iterator3_free(set_it);
+
+  // batch isn't removed partially, so elements are removed one by one, if any of them can't be removed
+  if (sc_memory_elements_free_batch(s_erase_elements_ctx, erase_addrs, erase_count) != SC_RESULT_OK)
+  {
+    sc_warning("Batch of %u sc-elements isn't erased, they are erased one by one", erase_count);
+    for (i = 0; i < erase_count; ++i)
+      sc_memory_element_free(s_erase_elements_ctx, erase_addrs[i]);
+  }
+  sc_mem_free(erase_addrs);
+
   // @TODO: edge from finish_question_successfully to question doesn't create
   finish_question_successfully(s_erase_elements_ctx, question_addr);
   return SC_RESULT_OK;
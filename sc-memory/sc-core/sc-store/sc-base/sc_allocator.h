@@ -16,6 +16,8 @@
 
 #define sc_mem_new(struct_type, n_structs) g_new0(struct_type, n_structs)
 
+#define sc_mem_renew(pointer, struct_type, n_structs) g_renew(struct_type, pointer, n_structs)
+
 #define sc_mem_set(pointer, constant, n_structs) memset(pointer, constant, n_structs)
 
 #define sc_mem_cpy(source, dest, n_structs) memcpy(source, dest, n_structs)
@@ -47,6 +47,19 @@
 
 #define sc_atomic_pointer_xor(atomic, val) g_atomic_pointer_xor(atomic, val)
 
+//! Full memory barrier: memory accesses before it aren't reordered with accesses after it
+#if defined(__GNUC__) || defined(__clang__)
+#  define sc_atomic_fence() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+// atomic read-modify-write operations of glib are full barriers
+#  define sc_atomic_fence() \
+    do \
+    { \
+      gint __sc_fence = 0; \
+      g_atomic_int_add(&__sc_fence, 0); \
+    } while (0)
+#endif
+
 #undef GLIB
 
 #endif
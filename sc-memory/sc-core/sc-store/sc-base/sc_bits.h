@@ -0,0 +1,38 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_bits_h_
+#define _sc_bits_h_
+
+#include "../sc_platform.h"
+
+#if (SC_COMPILER == SC_COMPILER_MSVC)
+#  include <intrin.h>
+
+static __inline int _sc_bits_ctz64(unsigned __int64 value)
+{
+  unsigned long index;
+  _BitScanForward64(&index, value);
+  return (int)index;
+}
+
+//! Returns number of trailing zero bits in 64-bit value. Result is undefined for zero value
+#  define sc_bits_ctz64(value) _sc_bits_ctz64(value)
+
+//! Returns number of set bits in 64-bit value
+#  define sc_bits_popcount64(value) ((int)__popcnt64(value))
+
+#else
+
+//! Returns number of trailing zero bits in 64-bit value. Result is undefined for zero value
+#  define sc_bits_ctz64(value) __builtin_ctzll(value)
+
+//! Returns number of set bits in 64-bit value
+#  define sc_bits_popcount64(value) __builtin_popcountll(value)
+
+#endif
+
+#endif
@@ -0,0 +1,100 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_spin_h_
+#define _sc_spin_h_
+
+#include "../sc_platform.h"
+#include "../sc_types.h"
+
+#include <glib.h>
+
+#if (SC_COMPILER == SC_COMPILER_MSVC)
+#  include <intrin.h>
+#  if defined(_M_ARM) || defined(_M_ARM64)
+#    define sc_spin_pause() __yield()
+#  else
+#    define sc_spin_pause() _mm_pause()
+#  endif
+#elif defined(__i386__) || defined(__x86_64__)
+//! Tells processor, that current thread is in spin-wait loop
+#  define sc_spin_pause() __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#  define sc_spin_pause() __asm__ __volatile__("yield" ::: "memory")
+#else
+#  define sc_spin_pause() __asm__ __volatile__("" ::: "memory")
+#endif
+
+#if SC_IS_PLATFORM_LINUX
+#  include <limits.h>
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+//! Number of steps with exponentially growing count of pause instructions (1, 2, 4, ... 64)
+#define SC_SPIN_PAUSE_STEPS 7
+//! Number of steps, when thread gives its time slice to other threads, before it should be parked
+#define SC_SPIN_YIELD_STEPS 4
+
+//! State of adaptive waiting in spin loop
+typedef struct _sc_spin_backoff
+{
+  sc_uint32 step;
+} sc_spin_backoff;
+
+#define SC_SPIN_BACKOFF_INIT {0}
+
+/*! Waits before the next attempt to take a busy resource: spins with exponential backoff at first, then yields.
+ * @returns SC_FALSE, if spinning budget is exhausted and caller should park thread until resource will be released.
+ */
+static inline sc_bool sc_spin_backoff_wait(sc_spin_backoff * backoff)
+{
+  if (backoff->step < SC_SPIN_PAUSE_STEPS)
+  {
+    sc_uint32 i;
+    for (i = 0; i < (1u << backoff->step); ++i)
+      sc_spin_pause();
+
+    ++backoff->step;
+    return SC_TRUE;
+  }
+
+  if (backoff->step < SC_SPIN_PAUSE_STEPS + SC_SPIN_YIELD_STEPS)
+  {
+    g_thread_yield();
+    ++backoff->step;
+    return SC_TRUE;
+  }
+
+  return SC_FALSE;
+}
+
+/*! Parks current thread, while value by address equals to expected one. Can return spuriously, so caller
+ * should check its condition again. On platforms without futex just yields.
+ */
+static inline void sc_spin_park(sc_int32 * address, sc_int32 expected)
+{
+#if SC_IS_PLATFORM_LINUX
+  syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+#else
+  (void)address;
+  (void)expected;
+  g_thread_yield();
+#endif
+}
+
+//! Wakes all threads, that are parked on specified address
+static inline void sc_spin_unpark_all(sc_int32 * address)
+{
+#if SC_IS_PLATFORM_LINUX
+  syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#else
+  (void)address;
+#endif
+}
+
+#endif
@@ -0,0 +1,111 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_hash_set.h"
+
+#include "../../sc-base/sc_allocator.h"
+#include "../../sc-base/sc_assert_utils.h"
+
+#define SC_HASH_SET_MIN_CAPACITY 64
+
+static sc_uint32 _sc_hash_set_index(sc_uint32 capacity, sc_uint32 key)
+{
+  // multiplicative hashing, so keys with the same high bits are spread over slots
+  return (key * 0x9E3779B1u) & (capacity - 1);
+}
+
+static void _sc_hash_set_resize(sc_hash_set * set, sc_uint32 capacity)
+{
+  sc_hash_set_slot * old_slots = set->slots;
+  sc_uint32 const old_capacity = set->capacity;
+  sc_uint32 const old_generation = set->generation;
+
+  set->slots = sc_mem_new(sc_hash_set_slot, capacity);
+  set->capacity = capacity;
+  set->generation = 1;
+
+  sc_uint32 i;
+  for (i = 0; i < old_capacity; ++i)
+  {
+    if (old_slots[i].generation != old_generation)
+      continue;
+
+    sc_uint32 idx = _sc_hash_set_index(capacity, old_slots[i].key);
+    while (set->slots[idx].generation == set->generation)
+      idx = (idx + 1) & (capacity - 1);
+
+    set->slots[idx].key = old_slots[i].key;
+    set->slots[idx].generation = set->generation;
+  }
+
+  sc_mem_free(old_slots);
+}
+
+void sc_hash_set_init(sc_hash_set * set)
+{
+  set->slots = null_ptr;
+  set->capacity = 0;
+  set->size = 0;
+  set->generation = 1;
+}
+
+void sc_hash_set_destroy(sc_hash_set * set)
+{
+  sc_mem_free(set->slots);
+  sc_hash_set_init(set);
+}
+
+void sc_hash_set_clear(sc_hash_set * set)
+{
+  set->size = 0;
+  if (++set->generation == 0)
+  {
+    // generations are wrapped, so stale slots can look used
+    sc_mem_set(set->slots, 0, sizeof(sc_hash_set_slot) * set->capacity);
+    set->generation = 1;
+  }
+}
+
+sc_bool sc_hash_set_insert(sc_hash_set * set, sc_uint32 key)
+{
+  sc_assert(key != 0);
+
+  // keep load factor not greater than 1/2
+  if ((set->size + 1) * 2 > set->capacity)
+    _sc_hash_set_resize(set, set->capacity == 0 ? SC_HASH_SET_MIN_CAPACITY : set->capacity * 2);
+
+  sc_uint32 idx = _sc_hash_set_index(set->capacity, key);
+  while (set->slots[idx].generation == set->generation)
+  {
+    if (set->slots[idx].key == key)
+      return SC_FALSE;
+
+    idx = (idx + 1) & (set->capacity - 1);
+  }
+
+  set->slots[idx].key = key;
+  set->slots[idx].generation = set->generation;
+  ++set->size;
+
+  return SC_TRUE;
+}
+
+sc_bool sc_hash_set_contains(sc_hash_set const * set, sc_uint32 key)
+{
+  if (set->size == 0)
+    return SC_FALSE;
+
+  sc_uint32 idx = _sc_hash_set_index(set->capacity, key);
+  while (set->slots[idx].generation == set->generation)
+  {
+    if (set->slots[idx].key == key)
+      return SC_TRUE;
+
+    idx = (idx + 1) & (set->capacity - 1);
+  }
+
+  return SC_FALSE;
+}
@@ -0,0 +1,58 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_hash_set_h_
+#define _sc_hash_set_h_
+
+#include "../../sc_types.h"
+
+typedef struct _sc_hash_set_slot
+{
+  sc_uint32 key;
+  sc_uint32 generation;  // slot is used, if it equals to generation of set
+} sc_hash_set_slot;
+
+/*! A set of non-zero 32-bit keys with open addressing. It is cleared in constant time, so it can be reused
+ * without new allocations.
+ */
+typedef struct _sc_hash_set
+{
+  sc_hash_set_slot * slots;
+  sc_uint32 capacity;    // power of two
+  sc_uint32 size;        // number of keys in set
+  sc_uint32 generation;  // current generation of used slots
+} sc_hash_set;
+
+/*! Initializes empty sc-hash-set. Memory is allocated on the first insertion.
+ * @param set A sc-hash-set pointer to initialize
+ */
+void sc_hash_set_init(sc_hash_set * set);
+
+/*! Frees memory of sc-hash-set.
+ * @param set A sc-hash-set pointer to destroy
+ */
+void sc_hash_set_destroy(sc_hash_set * set);
+
+/*! Removes all keys from sc-hash-set. Allocated memory is kept.
+ * @param set A sc-hash-set pointer to clear
+ */
+void sc_hash_set_clear(sc_hash_set * set);
+
+/*! Inserts key into sc-hash-set.
+ * @param set A sc-hash-set pointer
+ * @param key A non-zero key to insert
+ * @returns Returns SC_TRUE, if key was inserted; SC_FALSE, if set already contains it.
+ */
+sc_bool sc_hash_set_insert(sc_hash_set * set, sc_uint32 key);
+
+/*! Checks if sc-hash-set contains key.
+ * @param set A sc-hash-set pointer
+ * @param key A non-zero key to find
+ * @returns Returns SC_TRUE, if set contains key; otherwise return SC_FALSE.
+ */
+sc_bool sc_hash_set_contains(sc_hash_set const * set, sc_uint32 key);
+
+#endif
@@ -0,0 +1,215 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_arc_index.h"
+
+#include "sc_defines.h"
+
+#include "sc-base/sc_allocator.h"
+#include "sc-base/sc_assert_utils.h"
+
+#include <glib.h>
+
+#define SC_ARC_INDEX_MIN_CAPACITY 64
+
+typedef struct _sc_arc_index_slot
+{
+  sc_uint32 begin;  // local sc-addr of sc-arc begin, it's zero for empty slot
+  sc_uint32 end;
+  sc_uint32 arc;
+} sc_arc_index_slot;
+
+//! Open addressing table with linear probing. Sc-arcs with the same begin and end are in the same probe sequence
+typedef struct _sc_arc_index_shard
+{
+  GMutex mutex;
+  sc_arc_index_slot * slots;
+  sc_uint32 capacity;  // power of two
+  sc_uint32 size;
+} sc_arc_index_shard;
+
+sc_arc_index_shard s_arc_index_shards[SC_ARC_INDEX_SHARDS_COUNT];
+
+sc_uint64 _sc_arc_index_hash(sc_uint32 begin, sc_uint32 end)
+{
+  // mixer of 64-bit key, so neighbour sc-addrs are spread over shards and slots
+  sc_uint64 h = ((sc_uint64)begin << 32) | end;
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+sc_arc_index_shard * _sc_arc_index_get_shard(sc_uint64 hash)
+{
+  return &s_arc_index_shards[hash & (SC_ARC_INDEX_SHARDS_COUNT - 1)];
+}
+
+sc_uint32 _sc_arc_index_home(sc_arc_index_shard const * shard, sc_uint64 hash)
+{
+  return (sc_uint32)(hash >> 32) & (shard->capacity - 1);
+}
+
+void _sc_arc_index_insert(sc_arc_index_shard * shard, sc_arc_index_slot const * slot)
+{
+  sc_uint32 idx = _sc_arc_index_home(shard, _sc_arc_index_hash(slot->begin, slot->end));
+  while (shard->slots[idx].begin != 0)
+    idx = (idx + 1) & (shard->capacity - 1);
+
+  shard->slots[idx] = *slot;
+}
+
+void _sc_arc_index_resize(sc_arc_index_shard * shard, sc_uint32 capacity)
+{
+  sc_arc_index_slot * old_slots = shard->slots;
+  sc_uint32 const old_capacity = shard->capacity;
+
+  shard->slots = sc_mem_new(sc_arc_index_slot, capacity);
+  shard->capacity = capacity;
+
+  sc_uint32 i;
+  for (i = 0; i < old_capacity; ++i)
+  {
+    if (old_slots[i].begin != 0)
+      _sc_arc_index_insert(shard, &old_slots[i]);
+  }
+
+  sc_mem_free(old_slots);
+}
+
+void sc_arc_index_initialize()
+{
+  sc_uint32 i;
+  for (i = 0; i < SC_ARC_INDEX_SHARDS_COUNT; ++i)
+  {
+    sc_arc_index_shard * shard = &s_arc_index_shards[i];
+    g_mutex_init(&shard->mutex);
+    shard->slots = null_ptr;
+    shard->capacity = 0;
+    shard->size = 0;
+  }
+}
+
+void sc_arc_index_shutdown()
+{
+  sc_uint32 i;
+  for (i = 0; i < SC_ARC_INDEX_SHARDS_COUNT; ++i)
+  {
+    sc_arc_index_shard * shard = &s_arc_index_shards[i];
+    sc_mem_free(shard->slots);
+    shard->slots = null_ptr;
+    shard->capacity = 0;
+    shard->size = 0;
+    g_mutex_clear(&shard->mutex);
+  }
+}
+
+void sc_arc_index_append(sc_addr begin, sc_addr end, sc_addr arc)
+{
+  sc_arc_index_slot slot;
+  slot.begin = SC_ADDR_LOCAL_TO_INT(begin);
+  slot.end = SC_ADDR_LOCAL_TO_INT(end);
+  slot.arc = SC_ADDR_LOCAL_TO_INT(arc);
+  sc_assert(slot.begin != 0);
+
+  sc_arc_index_shard * shard = _sc_arc_index_get_shard(_sc_arc_index_hash(slot.begin, slot.end));
+  g_mutex_lock(&shard->mutex);
+
+  // load factor is kept not greater than 1/2, so probe sequences stay short
+  if ((shard->size + 1) * 2 > shard->capacity)
+    _sc_arc_index_resize(shard, shard->capacity == 0 ? SC_ARC_INDEX_MIN_CAPACITY : shard->capacity * 2);
+
+  _sc_arc_index_insert(shard, &slot);
+  ++shard->size;
+
+  g_mutex_unlock(&shard->mutex);
+}
+
+void sc_arc_index_remove(sc_addr begin, sc_addr end, sc_addr arc)
+{
+  sc_uint32 const begin_int = SC_ADDR_LOCAL_TO_INT(begin);
+  sc_uint32 const end_int = SC_ADDR_LOCAL_TO_INT(end);
+  sc_uint32 const arc_int = SC_ADDR_LOCAL_TO_INT(arc);
+  sc_uint64 const hash = _sc_arc_index_hash(begin_int, end_int);
+
+  sc_arc_index_shard * shard = _sc_arc_index_get_shard(hash);
+  g_mutex_lock(&shard->mutex);
+
+  if (shard->capacity == 0)
+    goto unlock;
+
+  sc_uint32 const mask = shard->capacity - 1;
+  sc_uint32 idx = _sc_arc_index_home(shard, hash);
+  while (shard->slots[idx].begin != 0 &&
+         (shard->slots[idx].arc != arc_int || shard->slots[idx].begin != begin_int ||
+          shard->slots[idx].end != end_int))
+    idx = (idx + 1) & mask;
+
+  if (shard->slots[idx].begin == 0)
+    goto unlock;
+
+  // slots of the probe sequence are shifted back, so there are no gaps in it without tombstones
+  sc_uint32 next = idx;
+  while (SC_TRUE)
+  {
+    next = (next + 1) & mask;
+    sc_arc_index_slot const * slot = &shard->slots[next];
+    if (slot->begin == 0)
+      break;
+
+    sc_uint32 const home = _sc_arc_index_home(shard, _sc_arc_index_hash(slot->begin, slot->end));
+    // slot can be moved into the gap, if its home isn't cyclically in range (idx, next]
+    if (((next - home) & mask) >= ((next - idx) & mask))
+    {
+      shard->slots[idx] = *slot;
+      idx = next;
+    }
+  }
+
+  shard->slots[idx].begin = 0;
+  --shard->size;
+
+unlock:
+  g_mutex_unlock(&shard->mutex);
+}
+
+sc_addr sc_arc_index_find(sc_addr begin, sc_addr end, sc_arc_index_filter filter, void * data)
+{
+  sc_addr result;
+  SC_ADDR_MAKE_EMPTY(result);
+
+  sc_uint32 const begin_int = SC_ADDR_LOCAL_TO_INT(begin);
+  sc_uint32 const end_int = SC_ADDR_LOCAL_TO_INT(end);
+  sc_uint64 const hash = _sc_arc_index_hash(begin_int, end_int);
+
+  sc_arc_index_shard * shard = _sc_arc_index_get_shard(hash);
+  g_mutex_lock(&shard->mutex);
+
+  if (shard->capacity == 0)
+    goto unlock;
+
+  sc_uint32 idx = _sc_arc_index_home(shard, hash);
+  for (; shard->slots[idx].begin != 0; idx = (idx + 1) & (shard->capacity - 1))
+  {
+    sc_arc_index_slot const * slot = &shard->slots[idx];
+    if (slot->begin != begin_int || slot->end != end_int)
+      continue;
+
+    sc_addr arc;
+    SC_ADDR_LOCAL_FROM_INT(slot->arc, arc);
+    if (filter(arc, data) == SC_TRUE)
+    {
+      result = arc;
+      break;
+    }
+  }
+
+unlock:
+  g_mutex_unlock(&shard->mutex);
+  return result;
+}
@@ -0,0 +1,37 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_arc_index_h_
+#define _sc_arc_index_h_
+
+#include "sc_types.h"
+
+/* Hash index of sc-arcs by their begin and end sc-elements. It's divided into shards with own locks, so threads,
+ * that change different pairs of sc-elements, rarely wait for each other. Index isn't saved and is built again,
+ * when segments are loaded.
+ */
+
+//! Checks if sc-arc, that is found in index, is suitable for search. It's called under lock of index shard
+typedef sc_bool (*sc_arc_index_filter)(sc_addr arc, void * data);
+
+void sc_arc_index_initialize();
+
+void sc_arc_index_shutdown();
+
+//! Appends sc-arc into index. It's called while begin and end sc-elements are locked
+void sc_arc_index_append(sc_addr begin, sc_addr end, sc_addr arc);
+
+//! Removes sc-arc from index. It's called while begin and end sc-elements are locked
+void sc_arc_index_remove(sc_addr begin, sc_addr end, sc_addr arc);
+
+/*! Finds sc-arc between specified sc-elements
+ * @param filter Function to check found sc-arcs. Sc-arcs, that are in index, aren't recycled, so it can read them
+ * without locks
+ * @returns Returns the first sc-arc, for which filter returns SC_TRUE; otherwise returns empty sc-addr
+ */
+sc_addr sc_arc_index_find(sc_addr begin, sc_addr end, sc_arc_index_filter filter, void * data);
+
+#endif
@@ -17,8 +17,17 @@
 
 #define MAX_PATH_LENGTH 1024
 
-#define SC_CONCURRENCY_LEVEL 32   // max number of independent threads that can work in parallel with memory
-#define SC_SEGMENT_CACHE_SIZE 32  // size of segments cache
+#define SC_CONCURRENCY_LEVEL 32               // default number of segment sections, that can be locked independently
+#define SC_CONCURRENCY_LEVEL_MAX 256          // max number of segment sections
+#define SC_SEGMENT_CACHE_SIZE 32              // size of segments cache
+#define SC_STORAGE_APPEND_BATCH_SIZE 256      // max number of sc-elements, that are appended into segment at once
+#define SC_EPOCH_STRIPES_COUNT 64             // number of stripes of epoch counters, that are chosen by threads
+#define SC_STORAGE_RECLAIM_THRESHOLD 64       // min number of retired sc-elements, that are recycled at once
+#define SC_ARC_INDEX_SHARDS_COUNT 64          // number of independently locked parts of sc-arcs index, power of two
+#define SC_EVENTS_TABLE_SHARDS_COUNT 64       // number of independently locked parts of sc-events table, power of two
+#define SC_EVENT_QUEUE_ORDER_LOCKS_COUNT 64   // number of locks of queued calls of sc-events, power of two
+#define SC_ITERATOR_BATCH_SIZE 64             // recommended number of iterator results to get at once by batch
+#define SC_ITERATOR_PARALLEL_CHUNK_SIZE 4096  // number of arcs, that are checked by one thread of parallel walk at once
 
 #if defined(SC_MEMORY_SELF_BUILD)
 #  if defined(SC_PLATFORM_WIN)
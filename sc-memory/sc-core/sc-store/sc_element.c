@@ -17,3 +17,32 @@ sc_bool sc_element_is_valid(sc_element * element)
 {
   return (element->flags.type == 0 || element->flags.type & sc_flag_request_deletion) ? SC_FALSE : SC_TRUE;
 }
+
+void sc_element_get_columns(sc_element const * element, sc_element_columns * columns)
+{
+  columns->type = element->flags.type;
+  columns->access_levels = element->flags.access_levels;
+  columns->reserved = 0;
+  columns->first_out_arc = element->first_out_arc;
+  columns->first_in_arc = element->first_in_arc;
+  columns->begin = element->arc.begin;
+  columns->end = element->arc.end;
+  columns->next_out_arc = element->arc.next_out_arc;
+  columns->next_in_arc = element->arc.next_in_arc;
+  columns->reserved_tail = 0;
+}
+
+sc_uint8 sc_element_get_arc_list(sc_type type)
+{
+  switch (type & sc_type_arc_mask)
+  {
+  case sc_type_edge_common:
+    return SC_ELEMENT_ARC_LIST_EDGE_COMMON;
+  case sc_type_arc_common:
+    return SC_ELEMENT_ARC_LIST_ARC_COMMON;
+  case sc_type_arc_access:
+    return SC_ELEMENT_ARC_LIST_ARC_ACCESS;
+  default:
+    return SC_ELEMENT_ARC_LIST_MIXED;
+  }
+}
@@ -71,8 +71,10 @@ struct _sc_element_meta
     sc_element_locks locks;  // bits access
     sc_uint8 locks_data;     // one byte
   };
+  sc_uint8 events_mask;  // bit (1 << type) is set, while sc-element has subscribed sc-events of this type
+  sc_uint8 retired;      // sc-element waits for recycling in retired list, it's changed under retired list lock
 
-  sc_uint32 ref_count;
+  sc_int32 ref_count;  // changed atomically without element lock, see sc_storage_element_ref
 };
 
 struct _sc_element
@@ -88,10 +90,65 @@ struct _sc_element
   sc_uint32 output_arcs_count;
 };
 
+/*! Fields of sc-element, that are read while traversing lists of arcs. When sc-memory is built with
+ * SC_SEGMENT_COLUMNS, segments store them in a separate column of 32-byte records, so traversal of arcs list touches
+ * one cache line per arc instead of the whole sc-element.
+ */
+struct _sc_element_columns
+{
+  sc_type type;
+  sc_access_levels access_levels;
+  sc_uint8 reserved;
+
+  sc_addr first_out_arc;
+  sc_addr first_in_arc;
+
+  sc_addr begin;
+  sc_addr end;
+  sc_addr next_out_arc;
+  sc_addr next_in_arc;
+
+  sc_uint32 reserved_tail;  // align record size to 32 bytes
+};
+
+//! Arcs of sc-element are grouped into lists by their sc_type_arc_mask bits: one list for each bit
+#define SC_ELEMENT_ARC_LIST_EDGE_COMMON 0
+#define SC_ELEMENT_ARC_LIST_ARC_COMMON 1
+#define SC_ELEMENT_ARC_LIST_ARC_ACCESS 2
+//! List of arcs, that have several of sc_type_arc_mask bits
+#define SC_ELEMENT_ARC_LIST_MIXED 3
+#define SC_ELEMENT_ARC_LISTS_COUNT 4
+
+/*! Index of sc-element arcs by their types. When sc-memory is built with SC_ARC_TYPE_INDEX, segments store it in
+ * a separate column, so iterators with arc type walk only arcs of suitable lists instead of all arcs of sc-element.
+ * It isn't saved and is built again, when segments are loaded.
+ */
+struct _sc_element_typed_arcs
+{
+  sc_addr first_out_arc[SC_ELEMENT_ARC_LISTS_COUNT];
+  sc_addr first_in_arc[SC_ELEMENT_ARC_LISTS_COUNT];
+
+  // sc-arc is in output list of its begin and in input list of its end, that correspond to its type
+  sc_addr next_out_arc;
+  sc_addr next_in_arc;
+  sc_addr prev_out_arc;
+  sc_addr prev_in_arc;
+
+  // numbers of arcs in lists, they are changed atomically and read without locks to estimate selectivity of arc types
+  sc_uint32 out_arcs_count[SC_ELEMENT_ARC_LISTS_COUNT];
+  sc_uint32 in_arcs_count[SC_ELEMENT_ARC_LISTS_COUNT];
+};
+
 /// All functions must be called for locked sc-elements
 void sc_element_set_type(sc_element * element, sc_type type);
 
 sc_bool sc_element_is_request_deletion(sc_element * element);
 sc_bool sc_element_is_valid(sc_element * element);
 
+//! Copies fields of sc-element, that are used to traverse arcs lists, into columns record
+void sc_element_get_columns(sc_element const * element, sc_element_columns * columns);
+
+//! Returns index of arcs list, that contains sc-arcs with specified type (see SC_ELEMENT_ARC_LIST_EDGE_COMMON)
+sc_uint8 sc_element_get_arc_list(sc_type type);
+
 #endif
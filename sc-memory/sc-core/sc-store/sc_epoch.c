@@ -0,0 +1,102 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_epoch.h"
+
+#include "sc_defines.h"
+
+#include "sc-base/sc_atomic.h"
+#include "sc-base/sc_assert_utils.h"
+
+#include <glib.h>
+
+/* Records are counted by epochs in stripes, so threads don't contend for one counter. Records can be only in the
+ * current and the previous epochs, so counters of three epochs are enough.
+ */
+typedef struct _sc_epoch_stripe
+{
+  sc_int32 counts[3];  // counts of records by epoch modulo 3
+  // stripes are in different cache lines
+  sc_uint8 padding[64 - 3 * sizeof(sc_int32)];
+} sc_epoch_stripe;
+
+sc_epoch_stripe s_epoch_stripes[SC_EPOCH_STRIPES_COUNT];
+sc_int32 s_epoch = 1;  // global epoch, it's never 0
+
+sc_uint32 _sc_epoch_next(sc_uint32 epoch)
+{
+  // zero is reserved for records, that aren't in epoch
+  return epoch == G_MAXUINT32 ? 1 : epoch + 1;
+}
+
+sc_uint32 _sc_epoch_prev(sc_uint32 epoch)
+{
+  return epoch == 1 ? G_MAXUINT32 : epoch - 1;
+}
+
+void sc_epoch_enter(sc_epoch_record * record)
+{
+  sc_assert(record != null_ptr);
+
+  sc_uint64 const hash = (sc_uint64)GPOINTER_TO_SIZE(sc_thread());
+  record->stripe = (sc_uint32)((hash >> 4) * 2654435761u >> 16) % SC_EPOCH_STRIPES_COUNT;
+  sc_epoch_stripe * stripe = &s_epoch_stripes[record->stripe];
+
+  // global epoch can advance, while record is counted, then it's counted in the new one
+  sc_uint32 epoch;
+  while (SC_TRUE)
+  {
+    epoch = sc_epoch_get();
+    sc_atomic_int_inc(&stripe->counts[epoch % 3]);
+    if (sc_epoch_get() == epoch)
+      break;
+
+    sc_atomic_int_add(&stripe->counts[epoch % 3], -1);
+  }
+
+  record->epoch = epoch;
+}
+
+void sc_epoch_exit(sc_epoch_record * record)
+{
+  if (record == null_ptr || record->epoch == 0)
+    return;
+
+  sc_atomic_int_add(&s_epoch_stripes[record->stripe].counts[record->epoch % 3], -1);
+  record->epoch = 0;
+}
+
+sc_bool sc_epoch_is_entered(sc_epoch_record const * record)
+{
+  return record->epoch != 0 ? SC_TRUE : SC_FALSE;
+}
+
+sc_uint32 sc_epoch_get()
+{
+  return (sc_uint32)sc_atomic_int_get(&s_epoch);
+}
+
+sc_uint32 sc_epoch_try_advance()
+{
+  sc_uint32 const epoch = sc_epoch_get();
+  sc_uint32 const prev_index = _sc_epoch_prev(epoch) % 3;
+
+  sc_uint32 i;
+  for (i = 0; i < SC_EPOCH_STRIPES_COUNT; ++i)
+  {
+    if (sc_atomic_int_get(&s_epoch_stripes[i].counts[prev_index]) != 0)
+      return epoch;
+  }
+
+  sc_atomic_int_compare_and_exchange(&s_epoch, (sc_int32)epoch, (sc_int32)_sc_epoch_next(epoch));
+  return sc_epoch_get();
+}
+
+sc_bool sc_epoch_is_safe(sc_uint32 retire_epoch)
+{
+  sc_uint32 const epoch = sc_epoch_get();
+  return epoch != retire_epoch && epoch != _sc_epoch_next(retire_epoch) ? SC_TRUE : SC_FALSE;
+}
@@ -0,0 +1,49 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_epoch_h_
+#define _sc_epoch_h_
+
+#include "sc_types.h"
+
+/* Epoch-based reclamation of sc-elements slots:
+ * - reader, that reads sc-elements without locks, enters epoch by its record and exits it, when it doesn't hold
+ *   their sc-addrs. Record isn't bound to thread, so it can be exited by any thread;
+ * - erased sc-element is retired with current global epoch, its slot keeps data and isn't reused;
+ * - global epoch advances, when none of records are in the previous epoch;
+ * - slot, that was retired in epoch E, is recycled, when global epoch becomes E + 2. Then all records,
+ *   that could read it, have exited their epochs. So one record, that isn't exited, delays recycling of all
+ *   sc-elements, that are retired after it has entered epoch.
+ */
+
+//! Epoch of reader, that is embedded into it
+struct _sc_epoch_record
+{
+  sc_uint32 epoch;   // entered epoch; 0, if record isn't in epoch
+  sc_uint32 stripe;  // counters stripe, where record is counted
+};
+
+//! Enters current global epoch by record, that isn't in epoch
+void sc_epoch_enter(sc_epoch_record * record);
+
+//! Exits epoch, that was entered by record. It can be called by any thread and does nothing, if record isn't in epoch
+void sc_epoch_exit(sc_epoch_record * record);
+
+//! Checks if record is in epoch
+sc_bool sc_epoch_is_entered(sc_epoch_record const * record);
+
+//! Returns current global epoch
+sc_uint32 sc_epoch_get();
+
+/*! Advances global epoch, if none of records are in the previous one
+ * @returns Global epoch after attempt
+ */
+sc_uint32 sc_epoch_try_advance();
+
+//! Checks if none of records can read memory, that was retired in specified epoch
+sc_bool sc_epoch_is_safe(sc_uint32 retire_epoch);
+
+#endif
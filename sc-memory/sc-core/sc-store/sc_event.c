@@ -17,16 +17,22 @@
 #include "sc-base/sc_assert_utils.h"
 #include "sc-base/sc_message.h"
 
-GMutex events_table_mutex;
-#define EVENTS_TABLE_LOCK g_mutex_lock(&events_table_mutex)
-#define EVENTS_TABLE_UNLOCK g_mutex_unlock(&events_table_mutex)
-
 #define TABLE_KEY(__Addr) GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(__Addr))
 
-// Pointer to hash table that contains events
-GHashTable * events_table = null_ptr;
+//! Part of events table with its own lock. Sc-elements are spread over shards by hash of their sc-addrs
+typedef struct _sc_events_table_shard
+{
+  GMutex mutex;
+  GHashTable * table;  // created with the first event of shard and destroyed with the last one
+} sc_events_table_shard;
+
+sc_events_table_shard events_table_shards[SC_EVENTS_TABLE_SHARDS_COUNT];
 sc_event_queue * event_queue = null_ptr;
 
+// destroying threads wait on condition, until the last references of their sc-events are removed
+GMutex events_destroy_mutex;
+GCond events_destroy_cond;
+
 guint events_table_hash_func(gconstpointer pointer)
 {
   return GPOINTER_TO_UINT(pointer);
@@ -37,92 +43,125 @@ gboolean events_table_equal_func(gconstpointer a, gconstpointer b)
   return (a == b);
 }
 
+sc_events_table_shard * _sc_events_table_get_shard(sc_addr addr)
+{
+  // multiplicative hash, so neighbour sc-addrs are in different shards
+  sc_uint32 const hash = (sc_uint32)SC_ADDR_LOCAL_TO_INT(addr) * 2654435761u;
+  return &events_table_shards[(hash >> 16) & (SC_EVENTS_TABLE_SHARDS_COUNT - 1)];
+}
+
+//! Returns bit of sc-event type in events mask of sc-elements
+sc_uint8 _sc_event_type_mask(sc_event_type type)
+{
+  return (type < 0 || (sc_uint32)type >= sizeof(sc_uint8) * 8) ? 0 : (sc_uint8)(1u << type);
+}
+
 //! Inserts specified event into events table
 sc_result insert_event_into_table(sc_event * event)
 {
   GSList * element_events_list = null_ptr;
+  sc_events_table_shard * shard = _sc_events_table_get_shard(event->element);
 
-  EVENTS_TABLE_LOCK;
+  g_mutex_lock(&shard->mutex);
 
   // the first, if table doesn't exist, then create it
-  if (events_table == null_ptr)
-    events_table = g_hash_table_new(events_table_hash_func, events_table_equal_func);
+  if (shard->table == null_ptr)
+    shard->table = g_hash_table_new(events_table_hash_func, events_table_equal_func);
+
+  sc_storage_set_element_events_mask(
+      event->element, sc_storage_get_element_events_mask(event->element) | _sc_event_type_mask(event->type));
 
   // if there are no events for specified sc-element, then create new events list
-  element_events_list = (GSList *)g_hash_table_lookup(events_table, TABLE_KEY(event->element));
+  element_events_list = (GSList *)g_hash_table_lookup(shard->table, TABLE_KEY(event->element));
   element_events_list = g_slist_append(element_events_list, (gpointer)event);
-  g_hash_table_insert(events_table, TABLE_KEY(event->element), (gpointer)element_events_list);
+  g_hash_table_insert(shard->table, TABLE_KEY(event->element), (gpointer)element_events_list);
 
-  EVENTS_TABLE_UNLOCK;
+  g_mutex_unlock(&shard->mutex);
 
   return SC_RESULT_OK;
 }
 
-//! Remove specified sc-event from events table
-sc_result remove_event_from_table(sc_event * event)
+/*! Remove specified sc-event from events table.
+ * @note Shard of events table, that contains sc-element, need to be locked
+ */
+sc_result remove_event_from_table_locked(sc_events_table_shard * shard, sc_event * event)
 {
   GSList * element_events_list = null_ptr;
-  sc_assert(events_table != null_ptr);
+  sc_assert(shard->table != null_ptr);
 
-  EVENTS_TABLE_LOCK;
-
-  element_events_list = (GSList *)g_hash_table_lookup(events_table, TABLE_KEY(event->element));
+  element_events_list = (GSList *)g_hash_table_lookup(shard->table, TABLE_KEY(event->element));
   if (element_events_list == null_ptr)
-  {
-    EVENTS_TABLE_UNLOCK;
     return SC_RESULT_ERROR_INVALID_PARAMS;
-  }
 
   // remove event from list of events for specified sc-element
   element_events_list = g_slist_remove(element_events_list, (gconstpointer)event);
   if (element_events_list == null_ptr)
-  {
-    g_hash_table_remove(events_table, TABLE_KEY(event->element));
-  }
+    g_hash_table_remove(shard->table, TABLE_KEY(event->element));
   else
-  {
-    g_hash_table_insert(events_table, TABLE_KEY(event->element), (gpointer)element_events_list);
-  }
+    g_hash_table_insert(shard->table, TABLE_KEY(event->element), (gpointer)element_events_list);
+
+  // the same type can be subscribed several times, so mask is collected from remaining events
+  sc_uint8 mask = 0;
+  GSList * item;
+  for (item = element_events_list; item != null_ptr; item = item->next)
+    mask |= _sc_event_type_mask(((sc_event *)item->data)->type);
+  sc_storage_set_element_events_mask(event->element, mask);
 
-  // if there are no more events in table, then delete it
-  if (g_hash_table_size(events_table) == 0)
+  // if there are no more events in shard, then delete its table
+  if (g_hash_table_size(shard->table) == 0)
   {
-    g_hash_table_destroy(events_table);
-    events_table = null_ptr;
+    g_hash_table_destroy(shard->table);
+    shard->table = null_ptr;
   }
 
-  EVENTS_TABLE_UNLOCK;
   return SC_RESULT_OK;
 }
 
 /// -----------------------------------------
 sc_bool _sc_event_try_emit(sc_event * evt)
 {
-  sc_bool res = SC_TRUE;
-
-  sc_event_lock(evt);
-
-  if (evt->ref_count & SC_EVENT_REQUEST_DESTROY)
+  while (SC_TRUE)
   {
-    res = SC_FALSE;
+    sc_uint32 const refs = sc_atomic_int_get(&evt->ref_count);
+    if (refs & SC_EVENT_REQUEST_DESTROY)
+      return SC_FALSE;
+
+    sc_assert(refs < SC_EVENT_REF_COUNT_MASK);
+    if (sc_atomic_int_compare_and_exchange(&evt->ref_count, refs, refs + 1))
+      return SC_TRUE;
   }
-  else
+}
+
+sc_bool sc_event_unref(sc_event * evt)
+{
+  sc_uint32 const refs = (sc_uint32)sc_atomic_int_add(&evt->ref_count, -1) - 1;
+
+  // sc-event isn't touched after the last reference is removed, because destroying thread can free it at once
+  if (refs == SC_EVENT_REQUEST_DESTROY)
   {
-    sc_assert(evt->ref_count < SC_EVENT_REF_COUNT_MASK);
-    evt->ref_count++;
+    g_mutex_lock(&events_destroy_mutex);
+    g_cond_broadcast(&events_destroy_cond);
+    g_mutex_unlock(&events_destroy_mutex);
   }
 
-  sc_event_unlock(evt);
-  return res;
+  return SC_FALSE;
 }
 
-sc_bool sc_event_unref(sc_event * evt)
+void sc_event_ref(sc_event * evt)
 {
-  sc_event_lock(evt);
-  --evt->ref_count;
-  sc_event_unlock(evt);
+  sc_atomic_int_inc(&evt->ref_count);
+}
 
-  return SC_FALSE;
+//! Waits, while emitted calls of destroyed sc-event are processed
+void _sc_event_wait_unref(sc_event * evt)
+{
+  if (sc_atomic_int_get(&evt->ref_count) == SC_EVENT_REQUEST_DESTROY)
+    return;
+
+  g_mutex_lock(&events_destroy_mutex);
+  while (sc_atomic_int_get(&evt->ref_count) != SC_EVENT_REQUEST_DESTROY)
+    g_cond_wait(&events_destroy_cond, &events_destroy_mutex);
+  g_mutex_unlock(&events_destroy_mutex);
 }
 
 // TODO: remove in 0.4.0
@@ -153,7 +192,6 @@ sc_event * sc_event_new(
   event->callback = callback;
   event->delete_callback = delete_callback;
   event->data = data;
-  event->thread_lock = null_ptr;
   event->ref_count = 1;
   event->access_levels = ctx->access_levels;
 
@@ -194,7 +232,6 @@ sc_event * sc_event_new_ex(
   event->callback_ex = callback;
   event->delete_callback = delete_callback;
   event->data = data;
-  event->thread_lock = null_ptr;
   event->ref_count = 1;
   event->access_levels = ctx->access_levels;
 
@@ -208,91 +245,150 @@ sc_event * sc_event_new_ex(
   return event;
 }
 
-sc_result sc_event_destroy(sc_event * evt)
+sc_event * sc_event_new_batch(
+    sc_memory_context const * ctx,
+    sc_addr el,
+    sc_event_type type,
+    sc_pointer data,
+    fEventCallbackBatch callback,
+    fDeleteCallback delete_callback,
+    sc_uint32 max_batch_size,
+    sc_uint32 max_delay_ms)
 {
-  sc_event_lock(evt);
-  if (evt->ref_count & SC_EVENT_REQUEST_DESTROY)
-  {
-    sc_event_unlock(evt);
-    goto unref;
-  }
+  sc_assert(callback != null_ptr);
+
+  if (SC_ADDR_IS_EMPTY(el))
+    return null_ptr;
+
+  sc_access_levels levels;
+  sc_event * event = null_ptr;
+  if (sc_storage_get_access_levels(ctx, el, &levels) != SC_RESULT_OK ||
+      !sc_access_lvl_check_read(ctx->access_levels, levels))
+    return null_ptr;
+
+  sc_storage_element_ref(el);
 
-  if (remove_event_from_table(evt) != SC_RESULT_OK)
+  event = sc_mem_new(sc_event, 1);
+  event->element = el;
+  event->type = type;
+  event->callback_batch = callback;
+  event->delete_callback = delete_callback;
+  event->data = data;
+  event->ref_count = 1;
+  event->access_levels = ctx->access_levels;
+  event->max_batch_size = max_batch_size == 0 ? 1 : max_batch_size;
+  event->max_batch_delay_ms = max_delay_ms;
+
+  // register created event
+  if (insert_event_into_table(event) != SC_RESULT_OK)
   {
-    sc_event_unlock(evt);
-    return SC_RESULT_ERROR;
+    sc_mem_free(event);
+    return null_ptr;
   }
 
-  evt->ref_count |= SC_EVENT_REQUEST_DESTROY;
-  evt->callback = null_ptr;
-  evt->callback_ex = null_ptr;
-  evt->delete_callback = null_ptr;
-  sc_event_unlock(evt);
+  return event;
+}
 
-unref:
+sc_result sc_event_destroy(sc_event * evt)
 {
-  sc_event_unref(evt);
-}
+  // sc-event is marked for destruction under lock of shard, so it can't be marked by deletion of its sc-element twice
+  sc_events_table_shard * shard = _sc_events_table_get_shard(evt->element);
+  g_mutex_lock(&shard->mutex);
 
-  // wait while will be available for destroy
-  while (SC_TRUE)
+  // sc-event of deleted sc-element is removed from table and marked already
+  if ((sc_atomic_int_get(&evt->ref_count) & SC_EVENT_REQUEST_DESTROY) == 0)
   {
-    sc_event_lock(evt);
-    sc_uint32 const refs = evt->ref_count;
-    if (refs == SC_EVENT_REQUEST_DESTROY)  // no refs
+    if (remove_event_from_table_locked(shard, evt) != SC_RESULT_OK)
     {
-      sc_storage_element_unref(evt->element);
-      if (evt->delete_callback != null_ptr)
-        evt->delete_callback(evt);
-
-      sc_event_unlock(evt);
-      sc_mem_free(evt);
-      break;
+      g_mutex_unlock(&shard->mutex);
+      return SC_RESULT_ERROR;
     }
-    sc_event_unlock(evt);
 
-    g_usleep(10000);
+    // pending calls are dropped, but batch callback isn't cleared, so collected batches are delivered
+    sc_atomic_int_or(&evt->ref_count, SC_EVENT_REQUEST_DESTROY);
+    evt->callback = null_ptr;
+    evt->callback_ex = null_ptr;
+    evt->delete_callback = null_ptr;
   }
 
+  g_mutex_unlock(&shard->mutex);
+
+  // collected batch of events holds reference, so it's passed to workers without waiting for its deadline
+  if (evt->max_batch_size != 0)
+    sc_event_queue_flush_batch(event_queue, evt);
+
+  sc_event_unref(evt);
+  _sc_event_wait_unref(evt);
+
+  sc_storage_element_unref(evt->element);
+  if (evt->delete_callback != null_ptr)
+    evt->delete_callback(evt);
+
+  sc_mem_free(evt);
+
   return SC_RESULT_OK;
 }
 
-sc_result sc_event_notify_element_deleted(sc_addr element)
+//! Destroys events of deleted sc-element. @note Shard of events table, that contains sc-element, need to be locked
+void _sc_event_notify_element_deleted_locked(sc_events_table_shard * shard, sc_addr element)
 {
-  EVENTS_TABLE_LOCK;
-
   GSList * element_events_list = null_ptr;
   sc_event * evt = null_ptr;
 
-  // do nothing, if there are no registered events
-  if (events_table == null_ptr)
-    goto result;
+  // do nothing, if there are no registered events in shard
+  if (shard->table == null_ptr)
+    return;
 
   // sc_set_lookup for all registered to specified sc-element events
-  element_events_list = (GSList *)g_hash_table_lookup(events_table, TABLE_KEY(element));
+  element_events_list = (GSList *)g_hash_table_lookup(shard->table, TABLE_KEY(element));
   if (element_events_list)
   {
-    g_hash_table_remove(events_table, TABLE_KEY(element));
+    g_hash_table_remove(shard->table, TABLE_KEY(element));
+    sc_storage_set_element_events_mask(element, 0);
 
     while (element_events_list != null_ptr)
     {
       evt = (sc_event *)element_events_list->data;
 
       // mark event for deletion
-      sc_event_lock(evt);
-      evt->ref_count |= SC_EVENT_REQUEST_DESTROY;
-      sc_event_unlock(evt);
+      sc_atomic_int_or(&evt->ref_count, SC_EVENT_REQUEST_DESTROY);
 
       element_events_list = g_slist_delete_link(element_events_list, element_events_list);
     }
     g_slist_free(element_events_list);
   }
+}
 
-result:
+sc_result sc_event_notify_element_deleted(sc_addr element)
 {
-  EVENTS_TABLE_UNLOCK;
+  return sc_event_notify_elements_deleted(&element, 1);
 }
 
+sc_result sc_event_notify_elements_deleted(sc_addr const * elements, sc_uint32 count)
+{
+  sc_events_table_shard * locked_shard = null_ptr;
+  sc_uint32 i;
+  for (i = 0; i < count; ++i)
+  {
+    if (sc_storage_get_element_events_mask(elements[i]) == 0)
+      continue;
+
+    // neighbour sc-elements of batch in the same shard are processed with one lock
+    sc_events_table_shard * shard = _sc_events_table_get_shard(elements[i]);
+    if (shard != locked_shard)
+    {
+      if (locked_shard != null_ptr)
+        g_mutex_unlock(&locked_shard->mutex);
+      locked_shard = shard;
+      g_mutex_lock(&locked_shard->mutex);
+    }
+
+    _sc_event_notify_element_deleted_locked(locked_shard, elements[i]);
+  }
+
+  if (locked_shard != null_ptr)
+    g_mutex_unlock(&locked_shard->mutex);
+
   return SC_RESULT_OK;
 }
 
@@ -320,8 +416,9 @@ sc_result sc_event_emit(
   return sc_event_emit_impl(ctx, el, el_access, type, edge, other_el);
 }
 
-sc_result sc_event_emit_impl(
-    sc_memory_context const * ctx,
+//! Appends events of sc-element into queue. @note Shard of events table, that contains sc-element, need to be locked
+void _sc_event_emit_locked(
+    sc_events_table_shard * shard,
     sc_addr el,
     sc_access_levels el_access,
     sc_event_type type,
@@ -333,14 +430,12 @@ sc_result sc_event_emit_impl(
 
   sc_assert(SC_ADDR_IS_NOT_EMPTY(el));
 
-  EVENTS_TABLE_LOCK;
-
-  // if table is empty, then do nothing
-  if (events_table == null_ptr)
-    goto result;
+  // if shard is empty, then do nothing
+  if (shard->table == null_ptr)
+    return;
 
   // sc_set_lookup for all registered to specified sc-element events
-  element_events_list = (GSList *)g_hash_table_lookup(events_table, TABLE_KEY(el));
+  element_events_list = (GSList *)g_hash_table_lookup(shard->table, TABLE_KEY(el));
 
   while (element_events_list != null_ptr)
   {
@@ -349,18 +444,68 @@ sc_result sc_event_emit_impl(
     if (event->type == type && sc_access_lvl_check_read(event->access_levels, el_access) &&
         _sc_event_try_emit(event) == SC_TRUE)
     {
-      sc_assert(event->callback != null_ptr || event->callback_ex != null_ptr);
+      sc_assert(event->callback != null_ptr || event->callback_ex != null_ptr || event->callback_batch != null_ptr);
       sc_event_queue_append(event_queue, event, edge, other_el);
     }
 
     element_events_list = element_events_list->next;
   }
+}
 
-result:
+sc_result sc_event_emit_impl(
+    sc_memory_context const * ctx,
+    sc_addr el,
+    sc_access_levels el_access,
+    sc_event_type type,
+    sc_addr edge,
+    sc_addr other_el)
 {
-  EVENTS_TABLE_UNLOCK;
+  // the most of sc-elements haven't subscribed events of this type, so they don't lock anything
+  if (sc_storage_element_has_events(el, type) == SC_FALSE)
+    return SC_RESULT_OK;
+
+  sc_events_table_shard * shard = _sc_events_table_get_shard(el);
+  g_mutex_lock(&shard->mutex);
+  _sc_event_emit_locked(shard, el, el_access, type, edge, other_el);
+  g_mutex_unlock(&shard->mutex);
+
+  return SC_RESULT_OK;
 }
 
+sc_result sc_event_emit_batch(sc_memory_context * ctx, sc_event_emit_params const * params, sc_uint32 count)
+{
+  sc_uint32 i;
+  if (ctx->flags & SC_CONTEXT_FLAG_PENDING_EVENTS)
+  {
+    for (i = 0; i < count; ++i)
+      sc_event_emit(ctx, params[i].el, params[i].el_access, params[i].type, params[i].edge, params[i].other_el);
+
+    return SC_RESULT_OK;
+  }
+
+  sc_events_table_shard * locked_shard = null_ptr;
+  for (i = 0; i < count; ++i)
+  {
+    sc_event_emit_params const * p = &params[i];
+    if (sc_storage_element_has_events(p->el, p->type) == SC_FALSE)
+      continue;
+
+    // neighbour events of batch for sc-elements in the same shard are emitted with one lock
+    sc_events_table_shard * shard = _sc_events_table_get_shard(p->el);
+    if (shard != locked_shard)
+    {
+      if (locked_shard != null_ptr)
+        g_mutex_unlock(&locked_shard->mutex);
+      locked_shard = shard;
+      g_mutex_lock(&locked_shard->mutex);
+    }
+
+    _sc_event_emit_locked(locked_shard, p->el, p->el_access, p->type, p->edge, p->other_el);
+  }
+
+  if (locked_shard != null_ptr)
+    g_mutex_unlock(&locked_shard->mutex);
+
   return SC_RESULT_OK;
 }
 
@@ -382,48 +527,16 @@ sc_addr sc_event_get_element(const sc_event * event)
   return event->element;
 }
 
-void sc_event_lock(sc_event * evt)
-{
-  sc_pointer thread = sc_thread();
-  while (SC_TRUE)
-  {
-    sc_memory_context * locked_thread = sc_atomic_pointer_get((void **)&evt->thread_lock);
-    if (locked_thread == thread)
-      return;
-
-    if ((locked_thread != null_ptr) ||
-        sc_atomic_pointer_compare_and_exchange((void **)&evt->thread_lock, (void *)locked_thread, (void *)thread) ==
-            SC_FALSE)
-    {
-      g_usleep(rand() % 10);
-    }
-    else
-    {
-      break;
-    }
-  }
-}
-
-void sc_event_unlock(sc_event * evt)
-{
-  sc_pointer thread = sc_thread();
-  sc_memory_context * locked_thread = sc_atomic_pointer_get((void **)&evt->thread_lock);
-  if (locked_thread != thread)
-    sc_critical("Invalid state of event lock");
-
-  sc_atomic_pointer_set((void **)&evt->thread_lock, null_ptr);
-}
-
 // --------
-sc_bool sc_events_initialize_ext(sc_uint32 const max_events_and_agents_threads)
+sc_bool sc_events_initialize_ext(sc_uint32 const max_events_and_agents_threads, sc_bool const ordered_delivery)
 {
-  event_queue = sc_event_queue_new_ext(max_events_and_agents_threads);
+  event_queue = sc_event_queue_new_ext(max_events_and_agents_threads, ordered_delivery);
   return SC_TRUE;
 }
 
 sc_bool sc_events_initialize()
 {
-  return sc_events_initialize_ext(g_get_num_processors());
+  return sc_events_initialize_ext(g_get_num_processors(), SC_FALSE);
 }
 
 void sc_events_shutdown()
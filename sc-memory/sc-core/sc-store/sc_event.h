@@ -24,6 +24,18 @@ typedef sc_result (*fEventCallback)(const sc_event * event, sc_addr arg);
 //! Delete listened element callback function type
 typedef sc_result (*fDeleteCallback)(const sc_event * event);
 
+//! Arguments of one emitted event, that is delivered in batch
+typedef struct _sc_event_batch_item
+{
+  sc_addr arg;       // sc-addr of added/remove edge
+  sc_addr other_el;  // sc-addr of another end of added/remove edge
+} sc_event_batch_item;
+
+/*! Event batch callback function type. It takes pointer to emitted event description and \p count arguments of
+ * events in order of their emit
+ */
+typedef sc_result (*fEventCallbackBatch)(const sc_event * event, sc_event_batch_item const * items, sc_uint32 count);
+
 /*! Subscribe for events from specified sc-element
  * @param el sc-addr of subscribed sc-element events
  * @param type Type of listening sc-events
@@ -50,6 +62,24 @@ _SC_EXTERN sc_event * sc_event_new_ex(
     fEventCallbackEx callback,
     fDeleteCallback delete_callback);
 
+/*! Subscribe for events from specified sc-element, that are delivered by batches. Emitted events are collected, until
+ * there are \p max_batch_size of them or the first of them waits for \p max_delay_ms milliseconds. So high-rate
+ * subscriptions are called once for many events. Collected batch is delivered, when sc-event is destroyed, while
+ * pending calls of other sc-events are dropped
+ * @param max_batch_size Maximum number of events in batch, it's not less than 1
+ * @param max_delay_ms Maximum time, that the first event of batch waits for other ones
+ * @remarks Other parameters are the same as in sc_event_new_ex
+ */
+_SC_EXTERN sc_event * sc_event_new_batch(
+    sc_memory_context const * ctx,
+    sc_addr el,
+    sc_event_type type,
+    sc_pointer data,
+    fEventCallbackBatch callback,
+    fDeleteCallback delete_callback,
+    sc_uint32 max_batch_size,
+    sc_uint32 max_delay_ms);
+
 /*! Destroys specified sc-event
  * @param event Pointer to sc-event, that need to be destroyed
  * @return If event destroyed correctly, then return SC_OK; otherwise return SC_ERROR code.
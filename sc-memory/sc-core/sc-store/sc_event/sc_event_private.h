@@ -10,12 +10,22 @@
 #include "../sc_event.h"
 #include "../sc_types.h"
 
+struct _sc_event_emit_params;
+
+//! Events, that are collected for batch callback of sc-event
+typedef struct _sc_event_batch
+{
+  sc_event_batch_item * items;
+  sc_uint32 count;
+  sc_uint32 capacity;
+  sc_int64 deadline;  // monotonic time in microseconds, when batch should be processed
+} sc_event_batch;
+
 /* Events life cycle:
  * - create event - set reference count to 1
  * - emit event - if there are no SC_EVENT_REQUEST_DESTROY flag, then ref sc_event and add it into pending queue
- * - destroy event - wait set flag SC_EVENT_REQUEST_DESTROY and wait until
- *   all pending calls of this event would be processed (ref count == 1).
- *   After that destroy event.
+ * - destroy event - set flag SC_EVENT_REQUEST_DESTROY, remove reference of creation and wait on condition until
+ *   all pending calls of this event would be processed (ref count == 0). After that destroy event.
  */
 
 #define SC_EVENT_REQUEST_DESTROY (1 << 31)
@@ -35,18 +45,32 @@ struct _sc_event
   fEventCallback callback;
   //! Pointer to callback function, that calls on event emit
   fEventCallbackEx callback_ex;
+  //! Pointer to callback function, that calls for batch of emitted events
+  fEventCallbackBatch callback_batch;
   //! Pointer to callback function, that calls, when subscribed sc-element deleted
   fDeleteCallback delete_callback;
-  //! Reference count (just references from queue). The highest bit used for SC_EVENT_REQUEST_DESTROY
-  volatile sc_uint32 ref_count;
-  //! Context lock
-  volatile sc_pointer thread_lock;
+  //! Reference count (just references from queue), it's changed atomically. The highest bit used for
+  //! SC_EVENT_REQUEST_DESTROY
+  sc_uint32 ref_count;
   //! Access levels
   sc_access_levels access_levels;
+  //! The oldest and the newest calls, that wait for processing, when events are delivered in order (see sc_event_queue)
+  struct _sc_event_queue_item * queued_head;
+  struct _sc_event_queue_item * queued_tail;
+  //! Maximum number of events in batch, it's 0, if events are delivered one by one
+  sc_uint32 max_batch_size;
+  //! Maximum time in milliseconds, that the first event of batch waits for other ones
+  sc_uint32 max_batch_delay_ms;
+  //! Events, that are collected, but aren't passed to workers yet (see sc_event_queue)
+  sc_event_batch * batch;
+  //! Position of batch timer in heap of queue plus 1, it's 0, if there is no timer. It's changed under lock of timers
+  sc_uint32 batch_timer_index;
 };
 
-//! Function to initialize sc-events module with user processors number
-sc_bool sc_events_initialize_ext(sc_uint32 max_events_and_agents_threads);
+/*! Function to initialize sc-events module with user processors number
+ * @param ordered_delivery If it's SC_TRUE, then calls of each sc-event are processed one by one in order of their emit
+ */
+sc_bool sc_events_initialize_ext(sc_uint32 max_events_and_agents_threads, sc_bool ordered_delivery);
 
 //! Function to initialize sc-events module
 sc_bool sc_events_initialize();
@@ -65,6 +89,9 @@ void sc_events_stop_processing();
  */
 sc_result sc_event_notify_element_deleted(sc_addr element);
 
+//! Notify about deletion of several sc-elements. Neighbour sc-elements of the same events table shard share one lock
+sc_result sc_event_notify_elements_deleted(sc_addr const * elements, sc_uint32 count);
+
 /*! Emit event with \p type for sc-element \p el with argument \p arg.
  * If \ctx is in a pending mode, then event will be pend for emit
  * @param ctx pointer to context, that emits event
@@ -84,6 +111,12 @@ sc_result sc_event_emit(
     sc_addr edge,
     sc_addr other_el);
 
+/*! Emit several events, neighbour events of the same events table shard are emitted with one lock. If \p ctx is in a
+ * pending mode, then events will be pend for emit
+ * @param params Array of \p count events parameters
+ */
+sc_result sc_event_emit_batch(sc_memory_context * ctx, struct _sc_event_emit_params const * params, sc_uint32 count);
+
 /*! Emit event immediately
  */
 sc_result sc_event_emit_impl(
@@ -95,14 +128,12 @@ sc_result sc_event_emit_impl(
     sc_addr other_el);
 
 /* Remove reference from event.
- * Remove reference from an event
+ * Remove reference from an event. If it's the last reference of destroyed event, then thread, that destroys it, is
+ * woken
  */
 sc_bool sc_event_unref(sc_event * evt);
 
-/* Lock sc-event by context
- */
-void sc_event_lock(sc_event * evt);
-
-void sc_event_unlock(sc_event * evt);
+//! Adds reference to event, that is already referenced by caller
+void sc_event_ref(sc_event * evt);
 
 #endif
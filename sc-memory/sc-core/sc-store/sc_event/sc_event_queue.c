@@ -9,68 +9,505 @@
 #include "sc_event_private.h"
 
 #include "../sc-base/sc_allocator.h"
+#include "../sc-base/sc_atomic.h"
 #include "../sc-base/sc_message.h"
 
+#define SC_EVENT_QUEUE_DEQUE_INITIAL_CAPACITY 64
+#define SC_EVENT_QUEUE_BATCH_INITIAL_CAPACITY 64
+#define SC_EVENT_QUEUE_TIMERS_INITIAL_CAPACITY 64
+
+// deque of current thread, it's null, if thread isn't a worker of queue
+GPrivate s_event_queue_worker_deque;
+
 typedef struct
 {
-  sc_event * evt;
-  sc_addr edge_addr;
-  sc_addr other_addr;
-} sc_event_pool_worker_data;
+  sc_event_queue * queue;
+  sc_uint32 index;
+} sc_event_queue_worker_data;
+
+//! Deadline of collected batch of sc-event. Each sc-event has one timer at most, it's in heap of queue
+typedef struct _sc_event_queue_batch_timer
+{
+  sc_event * evt;  // it's referenced by timer
+  sc_int64 deadline;
+} sc_event_queue_batch_timer;
+
+//! Appends item as the newest one. @note Deque need to be locked
+void _sc_event_queue_deque_push_locked(sc_event_queue_deque * deque, sc_event_queue_item * item)
+{
+  if (deque->count == deque->capacity)
+  {
+    // items are moved to the beginning of the new buffer in order from the oldest one
+    sc_uint32 const capacity = deque->capacity * 2;
+    sc_event_queue_item ** items = sc_mem_new(sc_event_queue_item *, capacity);
+    sc_uint32 i;
+    for (i = 0; i < deque->count; ++i)
+      items[i] = deque->items[(deque->head + i) & (deque->capacity - 1)];
+
+    sc_mem_free(deque->items);
+    deque->items = items;
+    deque->capacity = capacity;
+    deque->head = 0;
+  }
+
+  deque->items[(deque->head + deque->count) & (deque->capacity - 1)] = item;
+  ++deque->count;
+}
+
+//! Takes the oldest item of deque. @note Deque need to be locked
+sc_event_queue_item * _sc_event_queue_deque_pop_oldest_locked(sc_event_queue_deque * deque)
+{
+  if (deque->count == 0)
+    return null_ptr;
+
+  sc_event_queue_item * item = deque->items[deque->head];
+  deque->head = (deque->head + 1) & (deque->capacity - 1);
+  --deque->count;
+  return item;
+}
+
+//! Takes the newest item of deque. @note Deque need to be locked
+sc_event_queue_item * _sc_event_queue_deque_pop_newest_locked(sc_event_queue_deque * deque)
+{
+  if (deque->count == 0)
+    return null_ptr;
+
+  --deque->count;
+  return deque->items[(deque->head + deque->count) & (deque->capacity - 1)];
+}
+
+//! Returns deque, where current thread appends items
+sc_event_queue_deque * _sc_event_queue_get_deque(sc_event_queue * queue)
+{
+  sc_event_queue_deque * deque = g_private_get(&s_event_queue_worker_deque);
+  if (deque != null_ptr)
+    return deque;
 
-sc_event_pool_worker_data * sc_event_pool_worker_data_new(sc_event * evt, sc_addr edge_addr, sc_addr other_addr)
+  // threads, that aren't workers, spread items over all deques
+  sc_uint32 const index = (sc_uint32)sc_atomic_int_add(&queue->next_deque, 1);
+  return &queue->deques[index % queue->workers_count];
+}
+
+//! Appends item to deque and wakes one of sleeping workers
+void _sc_event_queue_push(sc_event_queue * queue, sc_event_queue_deque * deque, sc_event_queue_item * item)
 {
-  sc_event_pool_worker_data * data = sc_mem_new(sc_event_pool_worker_data, 1);
-  data->evt = evt;
-  data->edge_addr = edge_addr;
-  data->other_addr = other_addr;
+  g_mutex_lock(&deque->mutex);
+  _sc_event_queue_deque_push_locked(deque, item);
+  g_mutex_unlock(&deque->mutex);
+
+  sc_atomic_int_inc(&queue->items_count);
+  // worker checks number of items after it's counted as sleeping, so it can't miss this item
+  if (sc_atomic_int_get(&queue->sleeping_count) != 0)
+  {
+    g_mutex_lock(&queue->mutex);
+    g_cond_signal(&queue->cond);
+    g_mutex_unlock(&queue->mutex);
+  }
+}
+
+//! Takes free item from deque or allocates new one
+sc_event_queue_item * _sc_event_queue_item_new(sc_event_queue_deque * deque)
+{
+  g_mutex_lock(&deque->mutex);
+  sc_event_queue_item * item = deque->free_items;
+  if (item != null_ptr)
+    deque->free_items = item->next;
+  g_mutex_unlock(&deque->mutex);
+
+  if (item == null_ptr)
+    item = sc_mem_new(sc_event_queue_item, 1);
+
+  return item;
+}
+
+GMutex * _sc_event_queue_get_order_lock(sc_event_queue * queue, sc_event const * evt)
+{
+  sc_uint64 const hash = (sc_uint64)GPOINTER_TO_SIZE(evt) >> 4;
+  return &queue->order_locks[(hash * 2654435761u >> 16) & (SC_EVENT_QUEUE_ORDER_LOCKS_COUNT - 1)];
+}
+
+/*! Takes item from own deque, or steals it from deques of other workers. Processed item is returned into free list of
+ * own deque with the same lock
+ */
+sc_event_queue_item * _sc_event_queue_take(
+    sc_event_queue * queue,
+    sc_uint32 index,
+    sc_event_queue_item * processed_item)
+{
+  sc_event_queue_deque * deque = &queue->deques[index];
+  g_mutex_lock(&deque->mutex);
+  if (processed_item != null_ptr)
+  {
+    processed_item->next = deque->free_items;
+    deque->free_items = processed_item;
+  }
+  sc_event_queue_item * item = _sc_event_queue_deque_pop_oldest_locked(deque);
+  g_mutex_unlock(&deque->mutex);
 
-  return data;
+  sc_uint32 i;
+  for (i = 1; item == null_ptr && i < queue->workers_count; ++i)
+  {
+    sc_event_queue_deque * victim = &queue->deques[(index + i) % queue->workers_count];
+    if (sc_atomic_int_get(&victim->count) == 0)
+      continue;
+
+    g_mutex_lock(&victim->mutex);
+    item = _sc_event_queue_deque_pop_newest_locked(victim);
+    g_mutex_unlock(&victim->mutex);
+  }
+
+  if (item != null_ptr)
+    sc_atomic_int_add(&queue->items_count, -1);
+
+  return item;
 }
 
-void sc_event_pool_worker_data_destroy(sc_event_pool_worker_data * data)
+void _sc_event_queue_process(sc_event_queue * queue, sc_event_queue_item * item)
 {
-  sc_mem_free(data);
+  sc_event * evt = item->evt;
+  if (item->batch != null_ptr)
+  {
+    if (evt->callback_batch != null_ptr)
+      evt->callback_batch(evt, item->batch->items, item->batch->count);
+
+    sc_mem_free(item->batch->items);
+    sc_mem_free(item->batch);
+  }
+  else if (evt->callback != null_ptr)
+    evt->callback(evt, item->edge);
+  else if (evt->callback_ex != null_ptr)
+    evt->callback_ex(evt, item->edge, item->other_el);
+
+  if (queue->ordered_delivery)
+  {
+    // the next queued call of sc-event is appended, when the previous one is processed
+    GMutex * lock = _sc_event_queue_get_order_lock(queue, evt);
+    g_mutex_lock(lock);
+    sc_event_queue_item * next_item = item->next;
+    evt->queued_head = next_item;
+    if (next_item == null_ptr)
+      evt->queued_tail = null_ptr;
+    g_mutex_unlock(lock);
+
+    if (next_item != null_ptr)
+      _sc_event_queue_push(queue, _sc_event_queue_get_deque(queue), next_item);
+  }
+
+  // sc-event can be destroyed after that, so it isn't touched anymore
+  sc_event_unref(evt);
 }
 
-void sc_event_pool_worker(gpointer data, gpointer user_data)
+gpointer _sc_event_queue_worker(gpointer data)
 {
-  sc_event_pool_worker_data * work_data = (sc_event_pool_worker_data *)data;
+  sc_event_queue_worker_data * worker_data = data;
+  sc_event_queue * queue = worker_data->queue;
+  sc_uint32 const index = worker_data->index;
+  sc_mem_free(worker_data);
+
+  g_private_set(&s_event_queue_worker_deque, &queue->deques[index]);
 
-  if (work_data->evt->callback != null_ptr)
+  sc_event_queue_item * item = null_ptr;
+  while (SC_TRUE)
   {
-    work_data->evt->callback(work_data->evt, work_data->edge_addr);
+    item = _sc_event_queue_take(queue, index, item);
+    if (item != null_ptr)
+    {
+      _sc_event_queue_process(queue, item);
+      continue;
+    }
+
+    g_mutex_lock(&queue->mutex);
+    sc_atomic_int_inc(&queue->sleeping_count);
+    while (sc_atomic_int_get(&queue->items_count) == 0 && queue->stopping == SC_FALSE)
+      g_cond_wait(&queue->cond, &queue->mutex);
+    sc_atomic_int_add(&queue->sleeping_count, -1);
+    sc_bool const finish = queue->stopping && sc_atomic_int_get(&queue->items_count) == 0;
+    g_mutex_unlock(&queue->mutex);
+
+    if (finish)
+      break;
   }
-  else if (work_data->evt->callback_ex != null_ptr)
+
+  g_private_set(&s_event_queue_worker_deque, null_ptr);
+  return null_ptr;
+}
+
+//! Appends item to deque. If calls of sc-events are ordered, then item waits for processing of previous calls
+void _sc_event_queue_enqueue(sc_event_queue * queue, sc_event_queue_deque * deque, sc_event_queue_item * item)
+{
+  item->next = null_ptr;
+
+  if (queue->ordered_delivery)
   {
-    work_data->evt->callback_ex(work_data->evt, work_data->edge_addr, work_data->other_addr);
+    // call is queued after calls of sc-event, that aren't processed yet; the oldest of them is in deque
+    sc_event * evt = item->evt;
+    GMutex * lock = _sc_event_queue_get_order_lock(queue, evt);
+    g_mutex_lock(lock);
+    sc_bool const is_first = evt->queued_tail == null_ptr;
+    if (is_first)
+      evt->queued_head = item;
+    else
+      evt->queued_tail->next = item;
+    evt->queued_tail = item;
+    g_mutex_unlock(lock);
+
+    if (is_first == SC_FALSE)
+      return;
   }
 
-  sc_event_unref(work_data->evt);
-  sc_event_pool_worker_data_destroy(work_data);
+  _sc_event_queue_push(queue, deque, item);
 }
 
-sc_event_queue * sc_event_queue_new_ext(sc_uint32 max_events_and_agents_threads)
+//! Passes collected batch of sc-event to workers, if it's expired or \p force is SC_TRUE
+void _sc_event_queue_flush_batch(sc_event_queue * queue, sc_event * evt, sc_int64 now, sc_bool force)
+{
+  GMutex * lock = _sc_event_queue_get_order_lock(queue, evt);
+  g_mutex_lock(lock);
+  sc_event_batch * batch = evt->batch;
+  if (batch != null_ptr && (force || batch->deadline <= now))
+    evt->batch = null_ptr;
+  else
+    batch = null_ptr;
+  g_mutex_unlock(lock);
+
+  if (batch == null_ptr)
+    return;
+
+  sc_event_queue_deque * deque = _sc_event_queue_get_deque(queue);
+  sc_event_queue_item * item = _sc_event_queue_item_new(deque);
+  item->evt = evt;
+  item->batch = batch;
+  _sc_event_queue_enqueue(queue, deque, item);
+}
+
+//! Moves timer into position of heap and stores this position in its sc-event. @note Timers need to be locked
+void _sc_event_queue_timers_set_locked(sc_event_queue * queue, sc_uint32 index, sc_event_queue_batch_timer timer)
+{
+  queue->batches_timers[index] = timer;
+  timer.evt->batch_timer_index = index + 1;
+}
+
+//! Restores order of heap after deadline of timer was changed. @note Timers need to be locked
+void _sc_event_queue_timers_sift_locked(sc_event_queue * queue, sc_uint32 index)
+{
+  sc_event_queue_batch_timer * timers = queue->batches_timers;
+  sc_event_queue_batch_timer const timer = timers[index];
+
+  while (index > 0 && timers[(index - 1) / 2].deadline > timer.deadline)
+  {
+    _sc_event_queue_timers_set_locked(queue, index, timers[(index - 1) / 2]);
+    index = (index - 1) / 2;
+  }
+
+  while (SC_TRUE)
+  {
+    sc_uint32 child = index * 2 + 1;
+    if (child >= queue->batches_timers_count)
+      break;
+    if (child + 1 < queue->batches_timers_count && timers[child + 1].deadline < timers[child].deadline)
+      ++child;
+    if (timers[child].deadline >= timer.deadline)
+      break;
+
+    _sc_event_queue_timers_set_locked(queue, index, timers[child]);
+    index = child;
+  }
+
+  _sc_event_queue_timers_set_locked(queue, index, timer);
+}
+
+//! Removes timer of sc-event from heap. @note Timers need to be locked
+void _sc_event_queue_timers_remove_locked(sc_event_queue * queue, sc_event * evt)
+{
+  sc_uint32 const index = evt->batch_timer_index - 1;
+  evt->batch_timer_index = 0;
+
+  if (--queue->batches_timers_count == index)
+    return;
+
+  _sc_event_queue_timers_set_locked(queue, index, queue->batches_timers[queue->batches_timers_count]);
+  _sc_event_queue_timers_sift_locked(queue, index);
+}
+
+/*! Sets deadline of sc-event batch. If sc-event has no timer, then it's added and it references sc-event.
+ * @note Timers need to be locked
+ */
+void _sc_event_queue_timers_arm_locked(sc_event_queue * queue, sc_event * evt, sc_int64 deadline)
+{
+  sc_uint32 index = evt->batch_timer_index;
+  if (index == 0)
+  {
+    if (queue->batches_timers_count == queue->batches_timers_capacity)
+    {
+      queue->batches_timers_capacity =
+          sc_max(SC_EVENT_QUEUE_TIMERS_INITIAL_CAPACITY, queue->batches_timers_capacity * 2);
+      queue->batches_timers =
+          sc_mem_renew(queue->batches_timers, sc_event_queue_batch_timer, queue->batches_timers_capacity);
+    }
+
+    sc_event_ref(evt);
+    index = ++queue->batches_timers_count;
+  }
+
+  sc_event_queue_batch_timer timer;
+  timer.evt = evt;
+  timer.deadline = deadline;
+  _sc_event_queue_timers_set_locked(queue, index - 1, timer);
+  _sc_event_queue_timers_sift_locked(queue, index - 1);
+}
+
+/*! Waits for the nearest deadline of batches and passes expired batches to workers. All batches are passed, when
+ * queue is destroyed
+ */
+gpointer _sc_event_queue_batches_flusher(gpointer data)
+{
+  sc_event_queue * queue = data;
+
+  g_mutex_lock(&queue->batches_mutex);
+  while (SC_TRUE)
+  {
+    sc_int64 const now = g_get_monotonic_time();
+    if (queue->batches_timers_count > 0 && (queue->batches_stopping || queue->batches_timers[0].deadline <= now))
+    {
+      // batch of timer could be passed to workers, when it became full, then sc-event has no batch or has the next one
+      sc_event * evt = queue->batches_timers[0].evt;
+      _sc_event_queue_timers_remove_locked(queue, evt);
+      sc_bool const force = queue->batches_stopping;
+      g_mutex_unlock(&queue->batches_mutex);
+
+      _sc_event_queue_flush_batch(queue, evt, now, force);
+      sc_event_unref(evt);
+
+      g_mutex_lock(&queue->batches_mutex);
+      continue;
+    }
+
+    if (queue->batches_stopping)
+      break;
+
+    if (queue->batches_timers_count == 0)
+      g_cond_wait(&queue->batches_cond, &queue->batches_mutex);
+    else
+      g_cond_wait_until(&queue->batches_cond, &queue->batches_mutex, queue->batches_timers[0].deadline);
+  }
+  g_mutex_unlock(&queue->batches_mutex);
+
+  return null_ptr;
+}
+
+//! Appends call to collected batch of sc-event. Batch is passed to workers, when it's full or its deadline comes
+void _sc_event_queue_append_to_batch(sc_event_queue * queue, sc_event * evt, sc_addr edge, sc_addr other_el)
+{
+  sc_event_batch * full_batch = null_ptr;
+  sc_bool is_stopping = SC_FALSE;
+
+  GMutex * lock = _sc_event_queue_get_order_lock(queue, evt);
+  g_mutex_lock(lock);
+  sc_event_batch * batch = evt->batch;
+  sc_bool const is_new = batch == null_ptr;
+  if (is_new)
+  {
+    batch = sc_mem_new(sc_event_batch, 1);
+    batch->capacity = sc_min(evt->max_batch_size, SC_EVENT_QUEUE_BATCH_INITIAL_CAPACITY);
+    batch->items = sc_mem_new(sc_event_batch_item, batch->capacity);
+    batch->deadline = g_get_monotonic_time() + (sc_int64)evt->max_batch_delay_ms * 1000;
+    evt->batch = batch;
+
+    // timer is armed under lock of sc-event batch, so its deadline is the deadline of the newest batch
+    g_mutex_lock(&queue->batches_mutex);
+    is_stopping = queue->batches_stopping;
+    if (is_stopping == SC_FALSE)
+    {
+      _sc_event_queue_timers_arm_locked(queue, evt, batch->deadline);
+      if (evt->batch_timer_index == 1)
+        g_cond_signal(&queue->batches_cond);
+    }
+    g_mutex_unlock(&queue->batches_mutex);
+  }
+
+  if (batch->count == batch->capacity)
+  {
+    batch->capacity = sc_min(batch->capacity * 2, evt->max_batch_size);
+    batch->items = sc_mem_renew(batch->items, sc_event_batch_item, batch->capacity);
+  }
+
+  batch->items[batch->count].arg = edge;
+  batch->items[batch->count].other_el = other_el;
+  if (++batch->count == evt->max_batch_size)
+  {
+    evt->batch = null_ptr;
+    full_batch = batch;
+  }
+  g_mutex_unlock(lock);
+
+  // batch holds reference of its first call only
+  if (is_new == SC_FALSE)
+    sc_event_unref(evt);
+
+  if (full_batch != null_ptr)
+  {
+    sc_event_queue_deque * deque = _sc_event_queue_get_deque(queue);
+    sc_event_queue_item * item = _sc_event_queue_item_new(deque);
+    item->evt = evt;
+    item->batch = full_batch;
+    _sc_event_queue_enqueue(queue, deque, item);
+  }
+  else if (is_stopping)
+  {
+    // batches aren't waited for anymore, when queue is destroyed
+    _sc_event_queue_flush_batch(queue, evt, g_get_monotonic_time(), SC_TRUE);
+  }
+}
+
+sc_event_queue * sc_event_queue_new_ext(sc_uint32 max_events_and_agents_threads, sc_bool ordered_delivery)
 {
   sc_event_queue * queue = sc_mem_new(sc_event_queue, 1);
   queue->running = SC_TRUE;
+  queue->stopping = SC_FALSE;
+  queue->ordered_delivery = ordered_delivery;
   g_mutex_init(&queue->mutex);
+  g_cond_init(&queue->cond);
 
   max_events_and_agents_threads = sc_boundary(max_events_and_agents_threads, 1, g_get_num_processors());
   {
     sc_message("[sc-events] Configuration:");
     sc_message("\tMax events and agents threads: %d", max_events_and_agents_threads);
+    sc_message("\tOrdered events delivery: %s", ordered_delivery ? "On" : "Off");
   }
 
-  queue->thread_pool =
-      g_thread_pool_new(sc_event_pool_worker, null_ptr, (sc_int32)max_events_and_agents_threads, SC_FALSE, null_ptr);
+  sc_uint32 i;
+  for (i = 0; i < SC_EVENT_QUEUE_ORDER_LOCKS_COUNT; ++i)
+    g_mutex_init(&queue->order_locks[i]);
+
+  queue->workers_count = max_events_and_agents_threads;
+  queue->deques = sc_mem_new(sc_event_queue_deque, queue->workers_count);
+  for (i = 0; i < queue->workers_count; ++i)
+  {
+    sc_event_queue_deque * deque = &queue->deques[i];
+    g_mutex_init(&deque->mutex);
+    deque->capacity = SC_EVENT_QUEUE_DEQUE_INITIAL_CAPACITY;
+    deque->items = sc_mem_new(sc_event_queue_item *, deque->capacity);
+  }
+
+  g_mutex_init(&queue->batches_mutex);
+  g_cond_init(&queue->batches_cond);
+  queue->batches_flusher = g_thread_new("sc-events-batches", _sc_event_queue_batches_flusher, queue);
+
+  queue->workers = sc_mem_new(GThread *, queue->workers_count);
+  for (i = 0; i < queue->workers_count; ++i)
+  {
+    sc_event_queue_worker_data * data = sc_mem_new(sc_event_queue_worker_data, 1);
+    data->queue = queue;
+    data->index = i;
+    queue->workers[i] = g_thread_new("sc-events", _sc_event_queue_worker, data);
+  }
 
   return queue;
 }
 
 sc_event_queue * sc_event_queue_new()
 {
-  return sc_event_queue_new_ext(g_get_num_processors());
+  return sc_event_queue_new_ext(g_get_num_processors(), SC_FALSE);
 }
 
 void sc_event_queue_stop_processing(sc_event_queue * queue)
@@ -78,43 +515,95 @@ void sc_event_queue_stop_processing(sc_event_queue * queue)
   if (queue == null_ptr)
     return;
 
-  sc_bool is_running = SC_FALSE;
+  sc_atomic_int_set(&queue->running, SC_FALSE);
+}
+
+void sc_event_queue_destroy_wait(sc_event_queue * queue)
+{
+  if (queue == null_ptr)
+    return;
+
+  // collected batches are passed to workers before they finish
+  g_mutex_lock(&queue->batches_mutex);
+  queue->batches_stopping = SC_TRUE;
+  g_cond_signal(&queue->batches_cond);
+  g_mutex_unlock(&queue->batches_mutex);
+  g_thread_join(queue->batches_flusher);
+  sc_mem_free(queue->batches_timers);
+  g_cond_clear(&queue->batches_cond);
+  g_mutex_clear(&queue->batches_mutex);
 
   g_mutex_lock(&queue->mutex);
-  is_running = queue->running;
+  queue->stopping = SC_TRUE;
+  g_cond_broadcast(&queue->cond);
   g_mutex_unlock(&queue->mutex);
 
-  if (is_running)
+  sc_uint32 i;
+  for (i = 0; i < queue->workers_count; ++i)
+    g_thread_join(queue->workers[i]);
+  sc_mem_free(queue->workers);
+
+  for (i = 0; i < queue->workers_count; ++i)
   {
-    g_mutex_lock(&queue->mutex);
-    queue->running = SC_FALSE;
-    g_mutex_unlock(&queue->mutex);
+    sc_event_queue_deque * deque = &queue->deques[i];
+    while (deque->free_items != null_ptr)
+    {
+      sc_event_queue_item * item = deque->free_items;
+      deque->free_items = item->next;
+      sc_mem_free(item);
+    }
+
+    sc_mem_free(deque->items);
+    g_mutex_clear(&deque->mutex);
   }
+  sc_mem_free(queue->deques);
+
+  for (i = 0; i < SC_EVENT_QUEUE_ORDER_LOCKS_COUNT; ++i)
+    g_mutex_clear(&queue->order_locks[i]);
+
+  g_cond_clear(&queue->cond);
+  g_mutex_clear(&queue->mutex);
+  sc_mem_free(queue);
 }
 
-void sc_event_queue_destroy_wait(sc_event_queue * queue)
+void sc_event_queue_flush_batch(sc_event_queue * queue, sc_event * evt)
 {
   if (queue == null_ptr)
     return;
 
-  if (queue->thread_pool)
-  {
-    g_mutex_lock(&queue->mutex);
-    g_thread_pool_free(queue->thread_pool, SC_FALSE, SC_TRUE);
-    queue->thread_pool = null_ptr;
-    g_mutex_unlock(&queue->mutex);
-  }
+  g_mutex_lock(&queue->batches_mutex);
+  sc_bool const has_timer = evt->batch_timer_index != 0;
+  if (has_timer)
+    _sc_event_queue_timers_remove_locked(queue, evt);
+  g_mutex_unlock(&queue->batches_mutex);
 
-  sc_mem_free(queue);
+  _sc_event_queue_flush_batch(queue, evt, g_get_monotonic_time(), SC_TRUE);
+
+  // sc-event is referenced by caller, so it isn't destroyed here
+  if (has_timer)
+    sc_event_unref(evt);
 }
 
 void sc_event_queue_append(sc_event_queue * queue, sc_event * evt, sc_addr edge, sc_addr other_el)
 {
-  g_mutex_lock(&queue->mutex);
-  if (queue->running == SC_TRUE)
+  if (sc_atomic_int_get(&queue->running) == SC_FALSE)
   {
-    sc_event_pool_worker_data * data = sc_event_pool_worker_data_new(evt, edge, other_el);
-    g_thread_pool_push(queue->thread_pool, data, null_ptr);
+    // reference of event, that won't be processed, is removed, so its destruction doesn't wait for it
+    sc_event_unref(evt);
+    return;
   }
-  g_mutex_unlock(&queue->mutex);
+
+  if (evt->max_batch_size != 0)
+  {
+    _sc_event_queue_append_to_batch(queue, evt, edge, other_el);
+    return;
+  }
+
+  sc_event_queue_deque * deque = _sc_event_queue_get_deque(queue);
+  sc_event_queue_item * item = _sc_event_queue_item_new(deque);
+  item->evt = evt;
+  item->edge = edge;
+  item->other_el = other_el;
+  item->batch = null_ptr;
+  _sc_event_queue_enqueue(queue, deque, item);
 }
@@ -10,17 +10,60 @@
 #include "../sc_types.h"
 #include <glib.h>
 
-struct _sc_event_queue
+//! Emitted call of sc-event. Items are reused by free lists of queue deques
+typedef struct _sc_event_queue_item
+{
+  sc_event * evt;
+  sc_addr edge;
+  sc_addr other_el;
+  struct _sc_event_batch * batch;      // batch of calls, if sc-event takes them by batches
+  struct _sc_event_queue_item * next;  // next item in free list or in queued calls of the same sc-event
+} sc_event_queue_item;
+
+//! Deque of worker. Worker takes the oldest items, and other workers steal the newest ones, when they are idle
+typedef struct _sc_event_queue_deque
 {
   GMutex mutex;
-  sc_bool running;            // flag that determine if queue is running
-  GThreadPool * thread_pool;  // thread pool that used for a workers
+  sc_event_queue_item ** items;      // ring buffer
+  sc_uint32 capacity;                // power of two
+  sc_uint32 head;                    // index of the oldest item
+  sc_uint32 count;                   // number of items
+  sc_event_queue_item * free_items;  // items, that were processed by worker
+} sc_event_queue_deque;
+
+struct _sc_event_queue
+{
+  GMutex mutex;              // lock of sleeping workers
+  GCond cond;                // condition, that wakes sleeping workers
+  sc_uint32 running;         // not zero, while queue is running; it's changed atomically
+  sc_bool stopping;          // workers finish, when all items are processed
+  sc_bool ordered_delivery;  // calls of the same sc-event are processed one by one in order of their emit
+  sc_uint32 workers_count;   // number of workers and their deques
+  GThread ** workers;        // threads, that process events
+  sc_event_queue_deque * deques;
+  sc_uint32 next_deque;      // deque for the next item, that is appended by thread, that isn't worker
+  sc_uint32 items_count;     // number of items in all deques
+  sc_uint32 sleeping_count;  // number of workers, that wait for items
+  // locks of queued calls and batches of sc-events
+  GMutex order_locks[SC_EVENT_QUEUE_ORDER_LOCKS_COUNT];
+
+  GMutex batches_mutex;  // lock of batches timers
+  GCond batches_cond;    // condition, that wakes flusher of batches
+  // min-heap of timers by deadlines of collected batches, each timer holds reference of its sc-event
+  struct _sc_event_queue_batch_timer * batches_timers;
+  sc_uint32 batches_timers_count;
+  sc_uint32 batches_timers_capacity;
+  GThread * batches_flusher;  // thread, that passes batches to workers, when their deadlines come
+  sc_bool batches_stopping;   // flusher passes all batches and finishes
 };
 
 typedef struct _sc_event_queue sc_event_queue;
 
-//! Create new sc-event queue with user processors number
-sc_event_queue * sc_event_queue_new_ext(sc_uint32 max_events_and_agents_threads);
+/*! Create new sc-event queue with user processors number
+ * @param ordered_delivery If it's SC_TRUE, then calls of each sc-event are processed sequentially in order of their
+ * emit, while calls of different sc-events are processed in parallel
+ */
+sc_event_queue * sc_event_queue_new_ext(sc_uint32 max_events_and_agents_threads, sc_bool ordered_delivery);
 
 //! Create new sc-event queue
 sc_event_queue * sc_event_queue_new();
@@ -31,7 +74,10 @@ void sc_event_queue_stop_processing(sc_event_queue * queue);
 //! Destroys event queue. It waits until all events in queue will be processed
 void sc_event_queue_destroy_wait(sc_event_queue * queue);
 
-//! Appends \p event to queue
+//! Passes collected batch of sc-event to workers without waiting for its deadline, it's called on sc-event destroy
+void sc_event_queue_flush_batch(sc_event_queue * queue, sc_event * evt);
+
+//! Appends \p event to queue. If \p event takes events by batches, then call is appended to its collected batch
 void sc_event_queue_append(sc_event_queue * queue, sc_event * event, sc_addr edge, sc_addr other_el);
 
 #endif
@@ -7,22 +7,22 @@
 #include "sc_iterator.h"
 #include "sc_element.h"
 #include "sc_storage.h"
+#include "sc_epoch.h"
 #include "../sc_memory_private.h"
 
 #include "sc-base/sc_allocator.h"
+#include "sc-base/sc_atomic.h"
 #include "sc-base/sc_assert_utils.h"
 
-const sc_uint32 s_max_iterator_lock_attempts = 10;
-
-sc_iterator3 * sc_iterator3_f_a_a_new(const sc_memory_context * ctx, sc_addr el, sc_type arc_type, sc_type end_type)
+sc_iterator3 * sc_iterator3_f_a_a_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_addr el,
+    sc_type arc_type,
+    sc_type end_type)
 {
-  sc_access_levels levels;
   sc_iterator_param p1, p2, p3;
 
-  if (sc_storage_get_access_levels(ctx, el, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels))
-    return null_ptr;
-
   p1.is_type = SC_FALSE;
   p1.addr = el;
 
@@ -32,18 +32,18 @@ sc_iterator3 * sc_iterator3_f_a_a_new(const sc_memory_context * ctx, sc_addr el,
   p3.is_type = SC_TRUE;
   p3.type = end_type;
 
-  return sc_iterator3_new(ctx, sc_iterator3_f_a_a, p1, p2, p3);
+  return sc_iterator3_init(it, ctx, sc_iterator3_f_a_a, p1, p2, p3);
 }
 
-sc_iterator3 * sc_iterator3_a_a_f_new(const sc_memory_context * ctx, sc_type beg_type, sc_type arc_type, sc_addr el)
+sc_iterator3 * sc_iterator3_a_a_f_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_type arc_type,
+    sc_addr el)
 {
-  sc_access_levels levels;
   sc_iterator_param p1, p2, p3;
 
-  if (sc_storage_get_access_levels(ctx, el, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels))
-    return null_ptr;
-
   p1.is_type = SC_TRUE;
   p1.type = beg_type;
 
@@ -53,20 +53,16 @@ sc_iterator3 * sc_iterator3_a_a_f_new(const sc_memory_context * ctx, sc_type beg
   p3.is_type = SC_FALSE;
   p3.addr = el;
 
-  return sc_iterator3_new(ctx, sc_iterator3_a_a_f, p1, p2, p3);
+  return sc_iterator3_init(it, ctx, sc_iterator3_a_a_f, p1, p2, p3);
 }
 
-sc_iterator3 * sc_iterator3_f_a_f_new(const sc_memory_context * ctx, sc_addr el_beg, sc_type arc_type, sc_addr el_end)
+sc_iterator3 * sc_iterator3_f_a_f_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_addr el_beg,
+    sc_type arc_type,
+    sc_addr el_end)
 {
-  sc_access_levels levels;
-  if (sc_storage_get_access_levels(ctx, el_beg, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels) ||
-      sc_storage_get_access_levels(ctx, el_end, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels))
-  {
-    return null_ptr;
-  }
-
   sc_iterator_param p1, p2, p3;
 
   p1.is_type = SC_FALSE;
@@ -78,22 +74,16 @@ sc_iterator3 * sc_iterator3_f_a_f_new(const sc_memory_context * ctx, sc_addr el_
   p3.is_type = SC_FALSE;
   p3.addr = el_end;
 
-  return sc_iterator3_new(ctx, sc_iterator3_f_a_f, p1, p2, p3);
+  return sc_iterator3_init(it, ctx, sc_iterator3_f_a_f, p1, p2, p3);
 }
 
-sc_iterator3 * sc_iterator3_a_f_a_new(
+sc_iterator3 * sc_iterator3_a_f_a_init(
+    sc_iterator3 * it,
     sc_memory_context const * ctx,
     sc_type beg_type,
     sc_addr arc_addr,
     sc_type end_type)
 {
-  sc_access_levels levels;
-  if (sc_storage_get_access_levels(ctx, arc_addr, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels))
-  {
-    return null_ptr;
-  }
-
   sc_iterator_param p1, p2, p3;
 
   p1.is_type = SC_TRUE;
@@ -105,24 +95,16 @@ sc_iterator3 * sc_iterator3_a_f_a_new(
   p3.is_type = SC_TRUE;
   p3.type = end_type;
 
-  return sc_iterator3_new(ctx, sc_iterator3_a_f_a, p1, p2, p3);
+  return sc_iterator3_init(it, ctx, sc_iterator3_a_f_a, p1, p2, p3);
 }
 
-sc_iterator3 * sc_iterator3_f_f_a_new(
+sc_iterator3 * sc_iterator3_f_f_a_init(
+    sc_iterator3 * it,
     sc_memory_context const * ctx,
     sc_addr beg_addr,
     sc_addr edge_addr,
     sc_type end_type)
 {
-  sc_access_levels levels;
-  if (sc_storage_get_access_levels(ctx, beg_addr, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels) ||
-      sc_storage_get_access_levels(ctx, edge_addr, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels))
-  {
-    return null_ptr;
-  }
-
   sc_iterator_param p1, p2, p3;
 
   p1.is_type = SC_FALSE;
@@ -134,24 +116,16 @@ sc_iterator3 * sc_iterator3_f_f_a_new(
   p3.is_type = SC_TRUE;
   p3.type = end_type;
 
-  return sc_iterator3_new(ctx, sc_iterator3_f_f_a, p1, p2, p3);
+  return sc_iterator3_init(it, ctx, sc_iterator3_f_f_a, p1, p2, p3);
 }
 
-sc_iterator3 * sc_iterator3_a_f_f_new(
+sc_iterator3 * sc_iterator3_a_f_f_init(
+    sc_iterator3 * it,
     sc_memory_context const * ctx,
     sc_type beg_type,
     sc_addr edge_addr,
     sc_addr end_addr)
 {
-  sc_access_levels levels;
-  if (sc_storage_get_access_levels(ctx, end_addr, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels) ||
-      sc_storage_get_access_levels(ctx, edge_addr, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels))
-  {
-    return null_ptr;
-  }
-
   sc_iterator_param p1, p2, p3;
 
   p1.is_type = SC_TRUE;
@@ -163,26 +137,16 @@ sc_iterator3 * sc_iterator3_a_f_f_new(
   p3.is_type = SC_FALSE;
   p3.addr = end_addr;
 
-  return sc_iterator3_new(ctx, sc_iterator3_a_f_f, p1, p2, p3);
+  return sc_iterator3_init(it, ctx, sc_iterator3_a_f_f, p1, p2, p3);
 }
 
-sc_iterator3 * sc_iterator3_f_f_f_new(
+sc_iterator3 * sc_iterator3_f_f_f_init(
+    sc_iterator3 * it,
     sc_memory_context const * ctx,
     sc_addr beg_addr,
     sc_addr edge_addr,
     sc_addr end_addr)
 {
-  sc_access_levels levels;
-  if (sc_storage_get_access_levels(ctx, beg_addr, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels) ||
-      sc_storage_get_access_levels(ctx, end_addr, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels) ||
-      sc_storage_get_access_levels(ctx, edge_addr, &levels) != SC_RESULT_OK ||
-      !sc_access_lvl_check_read(ctx->access_levels, levels))
-  {
-    return null_ptr;
-  }
-
   sc_iterator_param p1, p2, p3;
 
   p1.is_type = SC_FALSE;
@@ -194,33 +158,19 @@ sc_iterator3 * sc_iterator3_f_f_f_new(
   p3.is_type = SC_FALSE;
   p3.addr = end_addr;
 
-  return sc_iterator3_new(ctx, sc_iterator3_f_f_f, p1, p2, p3);
+  return sc_iterator3_init(it, ctx, sc_iterator3_f_f_f, p1, p2, p3);
 }
 
-sc_bool _sc_iterator_ref_element(const sc_memory_context * ctx, sc_addr addr)
+//! Checks, that sc-element exists and can be read in context, by one read of its header without lock
+sc_bool _sc_iterator3_is_readable(sc_memory_context const * ctx, sc_addr addr)
 {
-  sc_element * el = null_ptr;
-  sc_uint16 a = 0;
-
-  while (a < 100)
-  {
-    STORAGE_CHECK_CALL(sc_storage_element_lock(addr, &el));
-    if (el != null_ptr && sc_element_is_request_deletion(el) == SC_FALSE && el->flags.type != 0)
-    {
-      sc_storage_element_ref(addr);
-      STORAGE_CHECK_CALL(sc_storage_element_unlock(addr));
-      return SC_TRUE;
-    }
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(addr));
-
-    a++;
-    g_usleep(10);
-  }
-
-  return SC_FALSE;
+  sc_type type;
+  sc_access_levels levels;
+  return sc_storage_get_element_header(ctx, addr, &type, &levels) == SC_RESULT_OK;
 }
 
-sc_iterator3 * sc_iterator3_new(
+sc_iterator3 * sc_iterator3_init(
+    sc_iterator3 * it,
     const sc_memory_context * ctx,
     sc_iterator3_type type,
     sc_iterator_param p1,
@@ -231,128 +181,187 @@ sc_iterator3 * sc_iterator3_new(
   if (type >= sc_iterator3_count)
     return null_ptr;
 
+  // fixed elements and reached arcs are protected by epoch, while iterator isn't finished
+  sc_epoch_enter(&it->epoch);
+
+  sc_bool is_valid = SC_FALSE;
   // check params with template
   switch (type)
   {
   case sc_iterator3_f_a_a:
-    if (p1.is_type || !p2.is_type || !p3.is_type || _sc_iterator_ref_element(ctx, p1.addr) != SC_TRUE)
-    {
-      return null_ptr;
-    }
+    is_valid = !p1.is_type && p2.is_type && p3.is_type && _sc_iterator3_is_readable(ctx, p1.addr);
     break;
 
   case sc_iterator3_a_a_f:
-    if (!p1.is_type || !p2.is_type || p3.is_type || _sc_iterator_ref_element(ctx, p3.addr) != SC_TRUE)
-    {
-      return null_ptr;
-    }
+    is_valid = p1.is_type && p2.is_type && !p3.is_type && _sc_iterator3_is_readable(ctx, p3.addr);
     break;
 
   case sc_iterator3_f_a_f:
-    if (p1.is_type || !p2.is_type || p3.is_type || _sc_iterator_ref_element(ctx, p1.addr) != SC_TRUE ||
-        _sc_iterator_ref_element(ctx, p3.addr) != SC_TRUE)
-    {
-      return null_ptr;
-    }
+    is_valid = !p1.is_type && p2.is_type && !p3.is_type && _sc_iterator3_is_readable(ctx, p1.addr) &&
+               _sc_iterator3_is_readable(ctx, p3.addr);
     break;
 
   case sc_iterator3_a_f_a:
-    if (!p1.is_type || p2.is_type || !p3.is_type || _sc_iterator_ref_element(ctx, p2.addr) != SC_TRUE)
-    {
-      return null_ptr;
-    }
+    is_valid = p1.is_type && !p2.is_type && p3.is_type && _sc_iterator3_is_readable(ctx, p2.addr);
     break;
 
   case sc_iterator3_f_f_a:
-    if (p1.is_type || p2.is_type || !p3.is_type || _sc_iterator_ref_element(ctx, p1.addr) != SC_TRUE ||
-        _sc_iterator_ref_element(ctx, p2.addr) != SC_TRUE)
-    {
-      return null_ptr;
-    }
+    is_valid = !p1.is_type && !p2.is_type && p3.is_type && _sc_iterator3_is_readable(ctx, p1.addr) &&
+               _sc_iterator3_is_readable(ctx, p2.addr);
     break;
 
   case sc_iterator3_a_f_f:
-    if (!p1.is_type || p2.is_type || p3.is_type || _sc_iterator_ref_element(ctx, p2.addr) != SC_TRUE ||
-        _sc_iterator_ref_element(ctx, p3.addr) != SC_TRUE)
-    {
-      return null_ptr;
-    }
+    is_valid = p1.is_type && !p2.is_type && !p3.is_type && _sc_iterator3_is_readable(ctx, p2.addr) &&
+               _sc_iterator3_is_readable(ctx, p3.addr);
     break;
 
   case sc_iterator3_f_f_f:
-    if (p1.is_type || p2.is_type || p3.is_type || _sc_iterator_ref_element(ctx, p1.addr) != SC_TRUE ||
-        _sc_iterator_ref_element(ctx, p2.addr) != SC_TRUE || _sc_iterator_ref_element(ctx, p3.addr) != SC_TRUE)
-    {
-      return null_ptr;
-    }
+    is_valid = !p1.is_type && !p2.is_type && !p3.is_type && _sc_iterator3_is_readable(ctx, p1.addr) &&
+               _sc_iterator3_is_readable(ctx, p2.addr) && _sc_iterator3_is_readable(ctx, p3.addr);
     break;
 
   default:
     break;
   }
 
-  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  if (is_valid == SC_FALSE)
+  {
+    sc_epoch_exit(&it->epoch);
+    return null_ptr;
+  }
 
   it->params[0] = p1;
   it->params[1] = p2;
   it->params[2] = p3;
 
+  // iterators start walk, when their results are empty
+  SC_ADDR_MAKE_EMPTY(it->results[0]);
+  SC_ADDR_MAKE_EMPTY(it->results[1]);
+  SC_ADDR_MAKE_EMPTY(it->results[2]);
+
   it->type = type;
   it->ctx = ctx;
+  it->access_levels = ctx->access_levels;
   it->finished = SC_FALSE;
+  it->reverse = SC_FALSE;
+
+  // iterators with arc type walk only lists of arcs, that can contain arcs of this type
+  it->arc_list = SC_ELEMENT_ARC_LISTS_COUNT;
+#ifdef SC_ARC_TYPE_INDEX
+  if (p2.is_type && (p2.type & sc_type_arc_mask) != 0)
+    it->arc_list = sc_element_get_arc_list(p2.type);
+#endif
 
   return it;
 }
 
-void sc_iterator3_free(sc_iterator3 * it)
+//! Returns initialized iterator, or frees its memory, if it wasn't initialized
+sc_iterator3 * _sc_iterator3_keep_allocated(sc_iterator3 * storage, sc_iterator3 * it)
 {
   if (it == null_ptr)
-    return;
+    sc_mem_free(storage);
 
-  if ((it->finished == SC_FALSE) && SC_ADDR_IS_NOT_EMPTY(it->results[1]))
-  {
-    sc_element * el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->results[1], &el));
-    sc_assert(el != null_ptr);
-    sc_storage_element_unref(it->results[1]);
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->results[1]));
-  }
-  switch (it->type)
-  {
-  case sc_iterator3_f_a_a:
-    sc_storage_element_unref(it->params[0].addr);
-    break;
+  return it;
+}
 
-  case sc_iterator3_a_a_f:
-    sc_storage_element_unref(it->params[2].addr);
-    break;
+sc_iterator3 * sc_iterator3_new(
+    const sc_memory_context * ctx,
+    sc_iterator3_type type,
+    sc_iterator_param p1,
+    sc_iterator_param p2,
+    sc_iterator_param p3)
+{
+  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  return _sc_iterator3_keep_allocated(it, sc_iterator3_init(it, ctx, type, p1, p2, p3));
+}
 
-  case sc_iterator3_f_a_f:
-    sc_storage_element_unref(it->params[0].addr);
-    sc_storage_element_unref(it->params[2].addr);
-    break;
+sc_iterator3 * sc_iterator3_f_a_a_new(
+    sc_memory_context const * ctx,
+    sc_addr el,
+    sc_type arc_type,
+    sc_type end_type)
+{
+  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  return _sc_iterator3_keep_allocated(it, sc_iterator3_f_a_a_init(it, ctx, el, arc_type, end_type));
+}
 
-  case sc_iterator3_a_f_a:
-    sc_storage_element_unref(it->params[1].addr);
-    break;
-  case sc_iterator3_f_f_a:
-    sc_storage_element_unref(it->params[0].addr);
-    sc_storage_element_unref(it->params[1].addr);
-    break;
-  case sc_iterator3_a_f_f:
-    sc_storage_element_unref(it->params[1].addr);
-    sc_storage_element_unref(it->params[2].addr);
-    break;
-  case sc_iterator3_f_f_f:
-    sc_storage_element_unref(it->params[0].addr);
-    sc_storage_element_unref(it->params[1].addr);
-    sc_storage_element_unref(it->params[2].addr);
-    break;
+sc_iterator3 * sc_iterator3_a_a_f_new(
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_type arc_type,
+    sc_addr el)
+{
+  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  return _sc_iterator3_keep_allocated(it, sc_iterator3_a_a_f_init(it, ctx, beg_type, arc_type, el));
+}
 
-  default:
-    break;
-  }
+sc_iterator3 * sc_iterator3_f_a_f_new(
+    sc_memory_context const * ctx,
+    sc_addr el_beg,
+    sc_type arc_type,
+    sc_addr el_end)
+{
+  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  return _sc_iterator3_keep_allocated(it, sc_iterator3_f_a_f_init(it, ctx, el_beg, arc_type, el_end));
+}
 
+sc_iterator3 * sc_iterator3_a_f_a_new(
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_addr arc_addr,
+    sc_type end_type)
+{
+  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  return _sc_iterator3_keep_allocated(it, sc_iterator3_a_f_a_init(it, ctx, beg_type, arc_addr, end_type));
+}
+
+sc_iterator3 * sc_iterator3_f_f_a_new(
+    sc_memory_context const * ctx,
+    sc_addr beg_addr,
+    sc_addr edge_addr,
+    sc_type end_type)
+{
+  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  return _sc_iterator3_keep_allocated(it, sc_iterator3_f_f_a_init(it, ctx, beg_addr, edge_addr, end_type));
+}
+
+sc_iterator3 * sc_iterator3_a_f_f_new(
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_addr edge_addr,
+    sc_addr end_addr)
+{
+  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  return _sc_iterator3_keep_allocated(it, sc_iterator3_a_f_f_init(it, ctx, beg_type, edge_addr, end_addr));
+}
+
+sc_iterator3 * sc_iterator3_f_f_f_new(
+    sc_memory_context const * ctx,
+    sc_addr beg_addr,
+    sc_addr edge_addr,
+    sc_addr end_addr)
+{
+  sc_iterator3 * it = sc_mem_new(sc_iterator3, 1);
+  return _sc_iterator3_keep_allocated(it, sc_iterator3_f_f_f_init(it, ctx, beg_addr, edge_addr, end_addr));
+}
+
+void sc_iterator3_destroy(sc_iterator3 * it)
+{
+  if (it == null_ptr)
+    return;
+
+  sc_epoch_exit(&it->epoch);
+
+  // arcs, that were erased while iterator walked them, can be recycled now
+  sc_storage_reclaim_elements(SC_FALSE);
+}
+
+void sc_iterator3_free(sc_iterator3 * it)
+{
+  if (it == null_ptr)
+    return;
+
+  sc_iterator3_destroy(it);
   sc_mem_free(it);
 }
 
@@ -366,77 +375,133 @@ sc_bool sc_iterator_param_compare(sc_element * el, sc_addr addr, sc_iterator_par
     return SC_ADDR_IS_EQUAL(addr, param.addr);
 }
 
+/* Iterator is in epoch, so arcs, that are reached from its elements, and their elements aren't recycled, while it
+ * isn't finished. They are read without locks, erased arcs are skipped, but their next arcs are still valid.
+ */
+
+//! Returns the last output or input arc of sc-element, the first added one
+sc_addr _sc_iterator3_last_arc(sc_addr el, sc_bool is_output)
+{
+  sc_element_columns columns;
+  sc_storage_read_element_columns(el, &columns);
+
+  sc_addr last = is_output ? columns.first_out_arc : columns.first_in_arc;
+  sc_addr arc = last;
+  while (SC_ADDR_IS_NOT_EMPTY(arc))
+  {
+    last = arc;
+    sc_storage_read_element_columns(arc, &columns);
+    arc = is_output ? columns.next_out_arc : columns.next_in_arc;
+  }
+
+  return last;
+}
+
+//! Returns the first output or input arc of sc-element, that can be suitable for iterator
+sc_addr _sc_iterator3_first_arc(sc_iterator3 * it, sc_addr el, sc_bool is_output)
+{
+  // reverse iterators walk list of all arcs
+  if (it->reverse == SC_TRUE)
+    return _sc_iterator3_last_arc(el, is_output);
+
+#ifdef SC_ARC_TYPE_INDEX
+  if (it->arc_list < SC_ELEMENT_ARC_LISTS_COUNT)
+  {
+    sc_element_typed_arcs typed;
+    sc_storage_read_element_typed_arcs(el, &typed);
+
+    // arcs with several sc_type_arc_mask bits can be suitable too, their list is walked the last
+    sc_addr arc = is_output ? typed.first_out_arc[it->arc_list] : typed.first_in_arc[it->arc_list];
+    if (SC_ADDR_IS_EMPTY(arc) && it->arc_list != SC_ELEMENT_ARC_LIST_MIXED)
+    {
+      it->arc_list = SC_ELEMENT_ARC_LIST_MIXED;
+      arc = is_output ? typed.first_out_arc[it->arc_list] : typed.first_in_arc[it->arc_list];
+    }
+
+    return arc;
+  }
+#endif
+
+  sc_element_columns columns;
+  sc_storage_read_element_columns(el, &columns);
+  return is_output ? columns.first_out_arc : columns.first_in_arc;
+}
+
+//! Returns arc, that is next to specified arc of sc-element and can be suitable for iterator
+sc_addr _sc_iterator3_next_arc(
+    sc_iterator3 * it,
+    sc_addr el,
+    sc_addr arc,
+    sc_element_columns const * arc_columns,
+    sc_bool is_output)
+{
+  if (it->reverse == SC_TRUE)
+    return sc_storage_read_prev_arc(arc, is_output);
+
+#ifdef SC_ARC_TYPE_INDEX
+  if (it->arc_list < SC_ELEMENT_ARC_LISTS_COUNT)
+  {
+    sc_element_typed_arcs typed;
+    sc_storage_read_element_typed_arcs(arc, &typed);
+
+    sc_addr const next = is_output ? typed.next_out_arc : typed.next_in_arc;
+    if (SC_ADDR_IS_NOT_EMPTY(next) || it->arc_list == SC_ELEMENT_ARC_LIST_MIXED)
+      return next;
+
+    it->arc_list = SC_ELEMENT_ARC_LIST_MIXED;
+    return _sc_iterator3_first_arc(it, el, is_output);
+  }
+#else
+  (void)it;
+  (void)el;
+  (void)arc;
+#endif
+
+  return is_output ? arc_columns->next_out_arc : arc_columns->next_in_arc;
+}
+
 sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
 {
   sc_addr arc_addr;
-  SC_ADDR_MAKE_EMPTY(arc_addr);
+  sc_element_columns columns;
 
   it->results[0] = it->params[0].addr;
 
   // try to find first output arc
   if (SC_ADDR_IS_EMPTY(it->results[1]))
-  {
-    sc_element * el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->params[0].addr, &el));
-    sc_assert(el != null_ptr);
-    arc_addr = el->first_out_arc;
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->params[0].addr));
-  }
+    arc_addr = _sc_iterator3_first_arc(it, it->params[0].addr, SC_TRUE);
   else
   {
-    sc_element * el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->results[1], &el));
-    sc_assert(el != null_ptr);
-    arc_addr = el->arc.next_out_arc;
-    sc_storage_element_unref(it->results[1]);
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->results[1]));
+    sc_storage_read_element_columns(it->results[1], &columns);
+    arc_addr = _sc_iterator3_next_arc(it, it->params[0].addr, it->results[1], &columns, SC_TRUE);
   }
 
   // iterate through output arcs
   while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
   {
-    sc_element * el = null_ptr;
-    // lock required elements to prevent deadlock with deletion
-    while (el == null_ptr)
-      STORAGE_CHECK_CALL(sc_storage_element_lock_try(arc_addr, s_max_iterator_lock_attempts, &el));
-
-    sc_storage_element_ref(arc_addr);
+    sc_element_columns arc;
+    sc_storage_read_element_columns(arc_addr, &arc);
 
-    sc_addr next_out_arc = el->arc.next_out_arc;
-    if (sc_element_is_request_deletion(el) == SC_FALSE)
+    if ((arc.type & sc_flag_request_deletion) == 0)
     {
-      sc_addr arc_end = el->arc.end;
-      sc_type arc_type = el->flags.type;
-      sc_access_levels arc_access = el->flags.access_levels;
-      sc_access_levels end_access;
-      if (sc_storage_get_access_levels(it->ctx, arc_end, &end_access) != SC_RESULT_OK)
-        end_access = sc_access_lvl_make_max;
-
-      STORAGE_CHECK_CALL(sc_storage_element_unlock(arc_addr));
-
-      sc_type el_type;
-      sc_storage_get_element_type(it->ctx, arc_end, &el_type);
-
-      if (sc_iterator_compare_type(arc_type, it->params[1].type) &&
-          sc_iterator_compare_type(el_type, it->params[2].type) &&
-          sc_access_lvl_check_read(it->ctx->access_levels, arc_access) &&
-          sc_access_lvl_check_read(it->ctx->access_levels, end_access))
+      sc_element_columns end;
+      sc_storage_read_element_columns(arc.end, &end);
+
+      if (sc_iterator_compare_type(arc.type, it->params[1].type) &&
+          sc_iterator_compare_type(end.type, it->params[2].type) &&
+          sc_access_lvl_check_read(it->access_levels, arc.access_levels) &&
+          sc_access_lvl_check_read(it->access_levels, end.access_levels))
       {
         // store found result
         it->results[1] = arc_addr;
-        it->results[2] = arc_end;
+        it->results[2] = arc.end;
 
         return SC_TRUE;
       }
     }
-    else
-    {
-      sc_storage_element_unref(arc_addr);
-      STORAGE_CHECK_CALL(sc_storage_element_unlock(arc_addr));
-    }
 
     // go to next arc
-    arc_addr = next_out_arc;
+    arc_addr = _sc_iterator3_next_arc(it, it->params[0].addr, arc_addr, &arc, SC_TRUE);
   }
 
   it->finished = SC_TRUE;
@@ -447,65 +512,37 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
 sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
 {
   sc_addr arc_addr;
-
-  SC_ADDR_MAKE_EMPTY(arc_addr);
+  sc_element_columns columns;
 
   it->results[0] = it->params[0].addr;
   it->results[2] = it->params[2].addr;
 
   // try to find first input arc
   if (SC_ADDR_IS_EMPTY(it->results[1]))
-  {
-    sc_element * el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->params[2].addr, &el));
-    sc_assert(el != null_ptr);
-    arc_addr = el->first_in_arc;
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->params[2].addr));
-  }
+    arc_addr = _sc_iterator3_first_arc(it, it->params[2].addr, SC_FALSE);
   else
   {
-    sc_element * el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->results[1], &el));
-    sc_assert(el != null_ptr);
-    arc_addr = el->arc.next_in_arc;
-    sc_storage_element_unref(it->results[1]);
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->results[1]));
+    sc_storage_read_element_columns(it->results[1], &columns);
+    arc_addr = _sc_iterator3_next_arc(it, it->params[2].addr, it->results[1], &columns, SC_FALSE);
   }
 
   // trying to find input arc, that created before iterator, and wasn't deleted
   while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
   {
-    sc_element * el = null_ptr;
-    while (el == null_ptr)
-      STORAGE_CHECK_CALL(sc_storage_element_lock_try(arc_addr, s_max_iterator_lock_attempts, &el));
-
-    sc_storage_element_ref(arc_addr);
-
-    sc_addr next_in_arc = el->arc.next_in_arc;
-    if (sc_element_is_request_deletion(el) == SC_FALSE)
-    {
-      sc_type arc_type = el->flags.type;
-      sc_addr arc_begin = el->arc.begin;
-      sc_access_levels arc_access = el->flags.access_levels;
+    sc_element_columns arc;
+    sc_storage_read_element_columns(arc_addr, &arc);
 
-      STORAGE_CHECK_CALL(sc_storage_element_unlock(arc_addr));
-
-      if (SC_ADDR_IS_EQUAL(it->params[0].addr, arc_begin) && sc_iterator_compare_type(arc_type, it->params[1].type) &&
-          sc_access_lvl_check_read(it->ctx->access_levels, arc_access))
-      {
-        // store found result
-        it->results[1] = arc_addr;
-        return SC_TRUE;
-      }
-    }
-    else
+    if ((arc.type & sc_flag_request_deletion) == 0 && SC_ADDR_IS_EQUAL(it->params[0].addr, arc.begin) &&
+        sc_iterator_compare_type(arc.type, it->params[1].type) &&
+        sc_access_lvl_check_read(it->access_levels, arc.access_levels))
     {
-      sc_storage_element_unref(arc_addr);
-      STORAGE_CHECK_CALL(sc_storage_element_unlock(arc_addr));
+      // store found result
+      it->results[1] = arc_addr;
+      return SC_TRUE;
     }
 
     // go to next arc
-    arc_addr = next_in_arc;
+    arc_addr = _sc_iterator3_next_arc(it, it->params[2].addr, arc_addr, &arc, SC_FALSE);
   }
 
   it->finished = SC_TRUE;
@@ -516,73 +553,45 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
 sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
 {
   sc_addr arc_addr;
-  SC_ADDR_MAKE_EMPTY(arc_addr);
+  sc_element_columns columns;
 
   it->results[2] = it->params[2].addr;
 
   // try to find first input arc
   if (SC_ADDR_IS_EMPTY(it->results[1]))
-  {
-    sc_element * el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->params[2].addr, &el));
-    sc_assert(el != null_ptr);
-    arc_addr = el->first_in_arc;
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->params[2].addr));
-  }
+    arc_addr = _sc_iterator3_first_arc(it, it->params[2].addr, SC_FALSE);
   else
   {
-    sc_element * el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->results[1], &el));
-    sc_assert(el != null_ptr);
-    arc_addr = el->arc.next_in_arc;
-    sc_storage_element_unref(it->results[1]);
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->results[1]));
+    sc_storage_read_element_columns(it->results[1], &columns);
+    arc_addr = _sc_iterator3_next_arc(it, it->params[2].addr, it->results[1], &columns, SC_FALSE);
   }
 
   // trying to find input arc, that created before iterator, and wasn't deleted
   while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
   {
-    sc_element * el = null_ptr;
-    while (el == null_ptr)
-      STORAGE_CHECK_CALL(sc_storage_element_lock_try(arc_addr, s_max_iterator_lock_attempts, &el));
-
-    sc_storage_element_ref(arc_addr);
+    sc_element_columns arc;
+    sc_storage_read_element_columns(arc_addr, &arc);
 
-    sc_addr next_in_arc = el->arc.next_in_arc;
-    if (sc_element_is_request_deletion(el) == SC_FALSE)
+    if ((arc.type & sc_flag_request_deletion) == 0)
     {
-      sc_type arc_type = el->flags.type;
-      sc_addr arc_begin = el->arc.begin;
-      sc_access_levels arc_access = el->flags.access_levels;
-      sc_access_levels begin_access;
-      if (sc_storage_get_access_levels(it->ctx, arc_begin, &begin_access) != SC_RESULT_OK)
-        begin_access = sc_access_lvl_make_max;
-
-      STORAGE_CHECK_CALL(sc_storage_element_unlock(arc_addr));
-
-      sc_type el_type = 0;
-      sc_storage_get_element_type(it->ctx, arc_begin, &el_type);
-
-      if (sc_iterator_compare_type(arc_type, it->params[1].type) &&
-          sc_iterator_compare_type(el_type, it->params[0].type) &&
-          sc_access_lvl_check_read(it->ctx->access_levels, arc_access) &&
-          sc_access_lvl_check_read(it->ctx->access_levels, begin_access))
+      sc_element_columns begin;
+      sc_storage_read_element_columns(arc.begin, &begin);
+
+      if (sc_iterator_compare_type(arc.type, it->params[1].type) &&
+          sc_iterator_compare_type(begin.type, it->params[0].type) &&
+          sc_access_lvl_check_read(it->access_levels, arc.access_levels) &&
+          sc_access_lvl_check_read(it->access_levels, begin.access_levels))
       {
         // store found result
         it->results[1] = arc_addr;
-        it->results[0] = arc_begin;
+        it->results[0] = arc.begin;
 
         return SC_TRUE;
       }
     }
-    else
-    {
-      sc_storage_element_unref(arc_addr);
-      STORAGE_CHECK_CALL(sc_storage_element_unlock(arc_addr));
-    }
 
     // go to next arc
-    arc_addr = next_in_arc;
+    arc_addr = _sc_iterator3_next_arc(it, it->params[2].addr, arc_addr, &arc, SC_FALSE);
   }
 
   it->finished = SC_TRUE;
@@ -597,12 +606,10 @@ sc_bool _sc_iterator3_a_f_a_next(sc_iterator3 * it)
     it->finished = SC_TRUE;
     it->results[1] = it->params[1].addr;
 
-    sc_element * arc_el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->params[1].addr, &arc_el));
-    sc_assert(arc_el != null_ptr);
-    it->results[0] = arc_el->arc.begin;
-    it->results[2] = arc_el->arc.end;
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->params[1].addr));
+    sc_element_columns arc;
+    sc_storage_read_element_columns(it->params[1].addr, &arc);
+    it->results[0] = arc.begin;
+    it->results[2] = arc.end;
 
     return SC_TRUE;
   }
@@ -615,21 +622,16 @@ sc_bool _sc_iterator3_f_f_a_next(sc_iterator3 * it)
   if (it->finished == SC_FALSE)
   {
     it->finished = SC_TRUE;
-    sc_bool result = SC_FALSE;
 
-    sc_element * edge_el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->params[1].addr, &edge_el));
-    sc_assert(edge_el != null_ptr);
-    if (SC_ADDR_IS_EQUAL(it->params[0].addr, edge_el->arc.begin))
+    sc_element_columns arc;
+    sc_storage_read_element_columns(it->params[1].addr, &arc);
+    if (SC_ADDR_IS_EQUAL(it->params[0].addr, arc.begin))
     {
-      result = SC_TRUE;
-      it->results[0] = edge_el->arc.begin;
+      it->results[0] = arc.begin;
       it->results[1] = it->params[1].addr;
-      it->results[2] = edge_el->arc.end;
+      it->results[2] = arc.end;
+      return SC_TRUE;
     }
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->params[1].addr));
-
-    return result;
   }
 
   return SC_FALSE;
@@ -640,21 +642,16 @@ sc_bool _sc_iterator3_a_f_f_next(sc_iterator3 * it)
   if (it->finished == SC_FALSE)
   {
     it->finished = SC_TRUE;
-    sc_bool result = SC_FALSE;
 
-    sc_element * edge_el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->params[1].addr, &edge_el));
-    sc_assert(edge_el != null_ptr);
-    if (SC_ADDR_IS_EQUAL(it->params[2].addr, edge_el->arc.end))
+    sc_element_columns arc;
+    sc_storage_read_element_columns(it->params[1].addr, &arc);
+    if (SC_ADDR_IS_EQUAL(it->params[2].addr, arc.end))
     {
-      result = SC_TRUE;
-      it->results[0] = edge_el->arc.begin;
+      it->results[0] = arc.begin;
       it->results[1] = it->params[1].addr;
-      it->results[2] = edge_el->arc.end;
+      it->results[2] = arc.end;
+      return SC_TRUE;
     }
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->params[1].addr));
-
-    return result;
   }
 
   return SC_FALSE;
@@ -665,60 +662,466 @@ sc_bool _sc_iterator3_f_f_f_next(sc_iterator3 * it)
   if (it->finished == SC_FALSE)
   {
     it->finished = SC_TRUE;
-    sc_bool result = SC_FALSE;
 
-    sc_element * edge_el = null_ptr;
-    STORAGE_CHECK_CALL(sc_storage_element_lock(it->params[1].addr, &edge_el));
-    sc_assert(edge_el != null_ptr);
-    if (SC_ADDR_IS_EQUAL(it->params[0].addr, edge_el->arc.begin) &&
-        SC_ADDR_IS_EQUAL(it->params[2].addr, edge_el->arc.end))
+    sc_element_columns arc;
+    sc_storage_read_element_columns(it->params[1].addr, &arc);
+    if (SC_ADDR_IS_EQUAL(it->params[0].addr, arc.begin) && SC_ADDR_IS_EQUAL(it->params[2].addr, arc.end))
     {
-      result = SC_TRUE;
-      it->results[0] = edge_el->arc.begin;
+      it->results[0] = arc.begin;
       it->results[1] = it->params[1].addr;
-      it->results[2] = edge_el->arc.end;
+      it->results[2] = arc.end;
+      return SC_TRUE;
     }
-    STORAGE_CHECK_CALL(sc_storage_element_unlock(it->params[1].addr));
-
-    return result;
   }
 
   return SC_FALSE;
 }
 
-sc_bool sc_iterator3_next(sc_iterator3 * it)
-{
-  if ((it == null_ptr) || (it->finished == SC_TRUE))
-    return SC_FALSE;
+typedef sc_bool (*sc_iterator3_next_func)(sc_iterator3 * it);
 
-  switch (it->type)
+sc_iterator3_next_func _sc_iterator3_get_next_func(sc_iterator3_type type)
+{
+  switch (type)
   {
   case sc_iterator3_f_a_a:
-    return _sc_iterator3_f_a_a_next(it);
+    return _sc_iterator3_f_a_a_next;
 
   case sc_iterator3_f_a_f:
-    return _sc_iterator3_f_a_f_next(it);
+    return _sc_iterator3_f_a_f_next;
 
   case sc_iterator3_a_a_f:
-    return _sc_iterator3_a_a_f_next(it);
+    return _sc_iterator3_a_a_f_next;
 
   case sc_iterator3_a_f_a:
-    return _sc_iterator3_a_f_a_next(it);
+    return _sc_iterator3_a_f_a_next;
 
   case sc_iterator3_f_f_a:
-    return _sc_iterator3_f_f_a_next(it);
+    return _sc_iterator3_f_f_a_next;
 
   case sc_iterator3_a_f_f:
-    return _sc_iterator3_a_f_f_next(it);
+    return _sc_iterator3_a_f_f_next;
 
   case sc_iterator3_f_f_f:
-    return _sc_iterator3_f_f_f_next(it);
+    return _sc_iterator3_f_f_f_next;
 
   default:
     break;
   }
 
-  return SC_FALSE;
+  return null_ptr;
+}
+
+//! Finished iterator doesn't read sc-elements, so it doesn't delay their recycling
+void _sc_iterator3_exit_epoch_if_finished(sc_iterator3 * it)
+{
+  if (it->finished == SC_TRUE)
+    sc_epoch_exit(&it->epoch);
+}
+
+sc_bool sc_iterator3_next(sc_iterator3 * it)
+{
+  if ((it == null_ptr) || (it->finished == SC_TRUE))
+    return SC_FALSE;
+
+  sc_iterator3_next_func const next = _sc_iterator3_get_next_func(it->type);
+  if (next == null_ptr)
+    return SC_FALSE;
+
+  sc_bool const result = next(it);
+  _sc_iterator3_exit_epoch_if_finished(it);
+  return result;
+}
+
+sc_uint32 sc_iterator3_next_batch(sc_iterator3 * it, sc_addr * results, sc_uint32 max_count)
+{
+  if ((it == null_ptr) || (it->finished == SC_TRUE))
+    return 0;
+
+  sc_iterator3_next_func const next = _sc_iterator3_get_next_func(it->type);
+  if (next == null_ptr)
+    return 0;
+
+  // iterator continues walk of arcs list from the last result, so batch is collected in one pass
+  sc_uint32 count = 0;
+  while (count < max_count && it->finished == SC_FALSE && next(it) == SC_TRUE)
+  {
+    results[0] = it->results[0];
+    results[1] = it->results[1];
+    results[2] = it->results[2];
+    results += 3;
+    ++count;
+  }
+
+  _sc_iterator3_exit_epoch_if_finished(it);
+  return count;
+}
+
+//! Returns SC_TRUE, if iterator walks output or input arcs list of fixed sc-element
+sc_bool _sc_iterator3_walks_arcs_list(sc_iterator3 const * it)
+{
+  return it->type == sc_iterator3_f_a_a || it->type == sc_iterator3_a_a_f || it->type == sc_iterator3_f_a_f;
+}
+
+sc_result sc_iterator3_set_reverse(sc_iterator3 * it)
+{
+  if (it == null_ptr || !_sc_iterator3_walks_arcs_list(it) || SC_ADDR_IS_NOT_EMPTY(it->results[1]))
+    return SC_RESULT_ERROR_INVALID_PARAMS;
+
+  // lists of arcs by types have their own order, so list of all arcs is walked backward
+  it->reverse = SC_TRUE;
+  it->arc_list = SC_ELEMENT_ARC_LISTS_COUNT;
+  return SC_RESULT_OK;
+}
+
+sc_bool sc_iterator3_get_cursor(sc_iterator3 const * it, sc_iterator3_cursor * cursor)
+{
+  if (it == null_ptr || !_sc_iterator3_walks_arcs_list(it) || it->finished == SC_TRUE ||
+      SC_ADDR_IS_EMPTY(it->results[1]))
+    return SC_FALSE;
+
+  cursor->arc = it->results[1];
+  cursor->begin = it->results[0];
+  cursor->end = it->results[2];
+  return SC_TRUE;
+}
+
+sc_result sc_iterator3_seek(sc_iterator3 * it, sc_iterator3_cursor const * cursor)
+{
+  if (it == null_ptr || !_sc_iterator3_walks_arcs_list(it))
+    return SC_RESULT_ERROR_INVALID_PARAMS;
+
+  // finished iterator has exited its epoch, so it enters the current one to continue walk
+  if (sc_epoch_is_entered(&it->epoch) == SC_FALSE)
+    sc_epoch_enter(&it->epoch);
+
+  // arc is checked by header at first, as cursor can contain any sc-addr
+  sc_type type;
+  sc_access_levels access_levels;
+  if (sc_storage_get_element_header(it->ctx, cursor->arc, &type, &access_levels) != SC_RESULT_OK ||
+      (type & sc_type_arc_mask) == 0)
+  {
+    _sc_iterator3_exit_epoch_if_finished(it);
+    return SC_RESULT_ERROR_NOT_FOUND;
+  }
+
+  // slot of erased arc can be reused by another arc, so its ends are compared with ends of cursor
+  sc_element_columns arc;
+  sc_storage_read_element_columns(cursor->arc, &arc);
+  sc_bool const is_begin_fixed = it->type == sc_iterator3_f_a_a || it->type == sc_iterator3_f_a_f;
+  sc_bool const is_end_fixed = it->type == sc_iterator3_a_a_f || it->type == sc_iterator3_f_a_f;
+  if (SC_ADDR_IS_NOT_EQUAL(arc.begin, cursor->begin) || SC_ADDR_IS_NOT_EQUAL(arc.end, cursor->end) ||
+      (is_begin_fixed && SC_ADDR_IS_NOT_EQUAL(arc.begin, it->params[0].addr)) ||
+      (is_end_fixed && SC_ADDR_IS_NOT_EQUAL(arc.end, it->params[2].addr)) ||
+      !sc_iterator_compare_type(arc.type, it->params[1].type))
+  {
+    _sc_iterator3_exit_epoch_if_finished(it);
+    return SC_RESULT_ERROR_NOT_FOUND;
+  }
+
+#ifdef SC_ARC_TYPE_INDEX
+  // suitable arc is in list of iterator arc type or in list of mixed arcs, that is walked after it
+  if (it->arc_list < SC_ELEMENT_ARC_LISTS_COUNT)
+    it->arc_list = sc_element_get_arc_list(arc.type);
+#endif
+
+  it->results[0] = arc.begin;
+  it->results[1] = cursor->arc;
+  it->results[2] = arc.end;
+  it->finished = SC_FALSE;
+  return SC_RESULT_OK;
+}
+
+//! Checks collected arc and its other end, as next() of iterator does, and fills results by them
+sc_bool _sc_iterator3_check_arc(sc_iterator3 const * it, sc_addr arc_addr, sc_addr * results)
+{
+  sc_element_columns arc;
+  sc_storage_read_element_columns(arc_addr, &arc);
+  if ((arc.type & sc_flag_request_deletion) != 0 || !sc_access_lvl_check_read(it->access_levels, arc.access_levels))
+    return SC_FALSE;
+
+  sc_bool const is_output = it->type == sc_iterator3_f_a_a;
+  sc_addr const other = is_output ? arc.end : arc.begin;
+  sc_element_columns other_columns;
+  sc_storage_read_element_columns(other, &other_columns);
+  if (!sc_iterator_compare_type(other_columns.type, is_output ? it->params[2].type : it->params[0].type) ||
+      !sc_access_lvl_check_read(it->access_levels, other_columns.access_levels))
+    return SC_FALSE;
+
+  results[0] = arc.begin;
+  results[1] = arc_addr;
+  results[2] = arc.end;
+  return SC_TRUE;
+}
+
+//! Chunk of collected arcs, that is checked by one thread
+typedef struct _sc_iterator3_walk_chunk
+{
+  struct _sc_iterator3_walk_chunk * next;
+  sc_uint32 count;
+  sc_addr arcs[SC_ITERATOR_PARALLEL_CHUNK_SIZE];
+} sc_iterator3_walk_chunk;
+
+/* State of parallel walk is shared by calling thread and workers of pool. Workers, that are started after walk is
+ * done, don't read it, so calling thread doesn't wait for them, and state is freed by the last of them.
+ */
+typedef struct _sc_iterator3_walk_state
+{
+  sc_iterator3 const * it;
+  GMutex mutex;
+  GCond cond;
+  sc_iterator3_walk_chunk * first_chunk;  // queue of collected chunks, that aren't taken by any thread
+  sc_iterator3_walk_chunk * last_chunk;
+  sc_bool is_collected;     // all chunks are queued
+  sc_bool is_done;          // all chunks are checked, so workers, that start now, do nothing
+  sc_uint32 running_count;  // number of workers, that check chunks now
+  sc_int32 results_count;   // number of results, that are passed to callback by all threads
+  sc_int32 refs_count;      // calling thread and pushed workers
+  sc_iterator3_walk_callback callback;
+  sc_pointer data;
+} sc_iterator3_walk_state;
+
+typedef struct _sc_iterator3_walk_task
+{
+  sc_iterator3_walk_state * walk;
+  sc_uint32 thread_index;
+} sc_iterator3_walk_task;
+
+GMutex s_walk_pool_mutex;
+GThreadPool * s_walk_pool = null_ptr;  // workers of all parallel walks
+
+void _sc_iterator3_walk_state_unref(sc_iterator3_walk_state * walk)
+{
+  if (sc_atomic_int_dec_and_test(&walk->refs_count) == SC_FALSE)
+    return;
+
+  g_cond_clear(&walk->cond);
+  g_mutex_clear(&walk->mutex);
+  sc_mem_free(walk);
+}
+
+//! Takes the first queued chunk. If there are no queued chunks, then waits for them, while arcs are collected
+sc_iterator3_walk_chunk * _sc_iterator3_walk_take_chunk(sc_iterator3_walk_state * walk)
+{
+  g_mutex_lock(&walk->mutex);
+  while (walk->first_chunk == null_ptr && walk->is_collected == SC_FALSE)
+    g_cond_wait(&walk->cond, &walk->mutex);
+
+  sc_iterator3_walk_chunk * chunk = walk->first_chunk;
+  if (chunk != null_ptr)
+  {
+    walk->first_chunk = chunk->next;
+    if (walk->first_chunk == null_ptr)
+      walk->last_chunk = null_ptr;
+  }
+  g_mutex_unlock(&walk->mutex);
+
+  return chunk;
+}
+
+//! Queues chunk to be checked by any thread of walk
+void _sc_iterator3_walk_queue_chunk(sc_iterator3_walk_state * walk, sc_iterator3_walk_chunk * chunk)
+{
+  g_mutex_lock(&walk->mutex);
+  if (walk->last_chunk == null_ptr)
+    walk->first_chunk = chunk;
+  else
+    walk->last_chunk->next = chunk;
+  walk->last_chunk = chunk;
+  g_cond_signal(&walk->cond);
+  g_mutex_unlock(&walk->mutex);
+}
+
+//! Takes chunks of arcs, while there are any of them, and passes their results to callback
+void _sc_iterator3_parallel_walk_chunks(sc_iterator3_walk_state * walk, sc_uint32 thread_index)
+{
+  sc_addr results[3];
+  sc_int32 found = 0;
+  sc_uint32 i;
+  sc_iterator3_walk_chunk * chunk;
+  while ((chunk = _sc_iterator3_walk_take_chunk(walk)) != null_ptr)
+  {
+    for (i = 0; i < chunk->count; ++i)
+    {
+      if (_sc_iterator3_check_arc(walk->it, chunk->arcs[i], results) == SC_TRUE)
+      {
+        walk->callback(thread_index, results, walk->data);
+        ++found;
+      }
+    }
+
+    sc_mem_free(chunk);
+  }
+
+  sc_atomic_int_add(&walk->results_count, found);
+}
+
+void _sc_iterator3_parallel_walk_worker(sc_pointer data, sc_pointer user_data)
+{
+  sc_iterator3_walk_task * task = data;
+  sc_iterator3_walk_state * walk = task->walk;
+
+  g_mutex_lock(&walk->mutex);
+  sc_bool const is_done = walk->is_done;
+  if (is_done == SC_FALSE)
+    ++walk->running_count;
+  g_mutex_unlock(&walk->mutex);
+
+  if (is_done == SC_FALSE)
+  {
+    _sc_iterator3_parallel_walk_chunks(walk, task->thread_index);
+
+    g_mutex_lock(&walk->mutex);
+    --walk->running_count;
+    g_cond_broadcast(&walk->cond);
+    g_mutex_unlock(&walk->mutex);
+  }
+
+  _sc_iterator3_walk_state_unref(walk);
+  sc_mem_free(task);
+}
+
+//! Returns pool of parallel walks workers, it's created by the first walk
+GThreadPool * _sc_iterator3_get_walk_pool()
+{
+  GThreadPool * pool = sc_atomic_pointer_get((void **)&s_walk_pool);
+  if (pool != null_ptr)
+    return pool;
+
+  g_mutex_lock(&s_walk_pool_mutex);
+  if (s_walk_pool == null_ptr)
+  {
+    pool = g_thread_pool_new(
+        _sc_iterator3_parallel_walk_worker, null_ptr, (sc_int32)g_get_num_processors(), SC_FALSE, null_ptr);
+    sc_atomic_pointer_set((void **)&s_walk_pool, pool);
+  }
+  pool = s_walk_pool;
+  g_mutex_unlock(&s_walk_pool_mutex);
+
+  return pool;
+}
+
+void sc_iterator3_parallel_walk_shutdown()
+{
+  g_mutex_lock(&s_walk_pool_mutex);
+  if (s_walk_pool != null_ptr)
+  {
+    g_thread_pool_free(s_walk_pool, SC_FALSE, SC_TRUE);
+    sc_atomic_pointer_set((void **)&s_walk_pool, null_ptr);
+  }
+  g_mutex_unlock(&s_walk_pool_mutex);
+}
+
+/*! Collects arcs of fixed sc-element with type of iterator, that aren't walked yet, without reading their other ends.
+ * Each collected chunk is queued at once, so it's checked by workers, while the next one is collected. Workers are
+ * pushed into pool, while there are queued chunks, that can be taken by them
+ */
+void _sc_iterator3_parallel_walk_collect(sc_iterator3_walk_state * walk, sc_uint32 threads_count)
+{
+  sc_iterator3 const * it = walk->it;
+  sc_bool const is_output = it->type == sc_iterator3_f_a_a;
+  sc_addr const el = is_output ? it->params[0].addr : it->params[2].addr;
+
+  sc_addr arc_addr;
+  sc_element_columns arc;
+  if (SC_ADDR_IS_EMPTY(it->results[1]))
+    arc_addr = _sc_iterator3_first_arc(it, el, is_output);
+  else
+  {
+    sc_storage_read_element_columns(it->results[1], &arc);
+    arc_addr = _sc_iterator3_next_arc(it, el, it->results[1], &arc, is_output);
+  }
+
+  sc_uint32 workers_count = 0;
+  sc_iterator3_walk_chunk * chunk = sc_mem_new(sc_iterator3_walk_chunk, 1);
+  while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
+  {
+    sc_storage_read_element_columns(arc_addr, &arc);
+    if ((arc.type & sc_flag_request_deletion) == 0 && sc_iterator_compare_type(arc.type, it->params[1].type))
+    {
+      chunk->arcs[chunk->count++] = arc_addr;
+      if (chunk->count == SC_ITERATOR_PARALLEL_CHUNK_SIZE)
+      {
+        _sc_iterator3_walk_queue_chunk(walk, chunk);
+        chunk = sc_mem_new(sc_iterator3_walk_chunk, 1);
+
+        // calling thread collects arcs now, so the first chunk is taken by worker
+        if (workers_count + 1 < threads_count)
+        {
+          ++workers_count;
+          sc_iterator3_walk_task * task = sc_mem_new(sc_iterator3_walk_task, 1);
+          task->walk = walk;
+          task->thread_index = workers_count;
+          sc_atomic_int_inc(&walk->refs_count);
+          g_thread_pool_push(_sc_iterator3_get_walk_pool(), task, null_ptr);
+        }
+      }
+    }
+
+    arc_addr = _sc_iterator3_next_arc(it, el, arc_addr, &arc, is_output);
+  }
+
+  if (chunk->count > 0)
+    _sc_iterator3_walk_queue_chunk(walk, chunk);
+  else
+    sc_mem_free(chunk);
+
+  g_mutex_lock(&walk->mutex);
+  walk->is_collected = SC_TRUE;
+  g_cond_broadcast(&walk->cond);
+  g_mutex_unlock(&walk->mutex);
+}
+
+sc_uint32 sc_iterator3_parallel_walk(
+    sc_iterator3 * it,
+    sc_uint32 threads_count,
+    sc_iterator3_walk_callback callback,
+    sc_pointer data)
+{
+  if ((it == null_ptr) || (it->finished == SC_TRUE))
+    return 0;
+
+  sc_uint32 count = 0;
+  if (it->type != sc_iterator3_f_a_a && it->type != sc_iterator3_a_a_f)
+  {
+    // there is no arcs list to split, so results are walked by calling thread
+    sc_iterator3_next_func const next = _sc_iterator3_get_next_func(it->type);
+    while (next != null_ptr && it->finished == SC_FALSE && next(it) == SC_TRUE)
+    {
+      callback(0, it->results, data);
+      ++count;
+    }
+
+    _sc_iterator3_exit_epoch_if_finished(it);
+    return count;
+  }
+
+  if (threads_count == 0)
+    threads_count = g_get_num_processors();
+
+  sc_iterator3_walk_state * walk = sc_mem_new(sc_iterator3_walk_state, 1);
+  walk->it = it;
+  g_mutex_init(&walk->mutex);
+  g_cond_init(&walk->cond);
+  walk->refs_count = 1;
+  walk->callback = callback;
+  walk->data = data;
+
+  _sc_iterator3_parallel_walk_collect(walk, threads_count);
+  _sc_iterator3_parallel_walk_chunks(walk, 0);
+
+  // collected arcs and their ends aren't recycled, because iterator exits its epoch, when all workers are finished
+  g_mutex_lock(&walk->mutex);
+  walk->is_done = SC_TRUE;
+  while (walk->running_count > 0)
+    g_cond_wait(&walk->cond, &walk->mutex);
+  g_mutex_unlock(&walk->mutex);
+
+  count = (sc_uint32)sc_atomic_int_get(&walk->results_count);
+  _sc_iterator3_walk_state_unref(walk);
+
+  it->finished = SC_TRUE;
+  _sc_iterator3_exit_epoch_if_finished(it);
+  return count;
 }
 
 sc_addr sc_iterator3_value(sc_iterator3 * it, sc_uint vid)
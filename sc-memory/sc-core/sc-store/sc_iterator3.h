@@ -10,6 +10,7 @@
 #include "sc_defines.h"
 #include "sc_types.h"
 #include "sc_element.h"
+#include "sc_epoch.h"
 
 //! sc-iterator types
 typedef enum
@@ -42,13 +43,25 @@ struct _sc_iterator_param
  */
 struct _sc_iterator3
 {
-  sc_iterator3_type type;         // iterator type (search template)
-  sc_iterator_param params[3];    // parameters array
-  sc_addr results[3];             // results array (same size as params)
-  const sc_memory_context * ctx;  // pointer to used memory context
+  sc_iterator3_type type;          // iterator type (search template)
+  sc_iterator_param params[3];     // parameters array
+  sc_addr results[3];              // results array (same size as params)
+  const sc_memory_context * ctx;   // pointer to used memory context
+  sc_access_levels access_levels;  // read rights of context, that are checked for each result
   sc_bool finished;
+  sc_epoch_record epoch;  // epoch of iterator, it protects reached elements from recycling until walk is finished
+  sc_uint8 arc_list;      // list of arcs by type, that is walked; SC_ELEMENT_ARC_LISTS_COUNT, if all arcs are walked
+  sc_bool reverse;        // arcs list is walked from its last arc to the first one
 };
 
+//! Position of iterator in arcs list, that can be used to resume walk by another iterator with the same parameters
+typedef struct _sc_iterator3_cursor
+{
+  sc_addr arc;    // arc of the last walked result
+  sc_addr begin;  // begin and end of arc are checked on resume to find out, that arc slot wasn't reused
+  sc_addr end;
+} sc_iterator3_cursor;
+
 /*! Create iterator to find output arcs for specified element
  * @param el sc-addr of element to iterate output arcs
  * @param arc_type Type of output arc to iterate (0 - all types)
@@ -125,8 +138,90 @@ _SC_EXTERN sc_iterator3 * sc_iterator3_new(
     sc_iterator_param p2,
     sc_iterator_param p3);
 
+/*! Initialize sc-iterator-3 in memory of caller, for example on stack, so iterator isn't allocated in heap
+ * @param it Pointer to memory for iterator
+ * @param type Iterator type (search template)
+ * @param p1 First iterator parameter
+ * @param p2 Second iterator parameter
+ * @param p3 Third iterator parameter
+ * @return Return it, if iterator initialized; otherwise return 0. Initialized iterator must be destroyed by
+ * sc_iterator3_destroy.
+ * example: sc_iterator3 storage; sc_iterator3 * it = sc_iterator3_f_a_a_init(&storage, ctx, addr, 0, 0);
+ */
+_SC_EXTERN sc_iterator3 * sc_iterator3_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_iterator3_type type,
+    sc_iterator_param p1,
+    sc_iterator_param p2,
+    sc_iterator_param p3);
+
+//! Initializes iterator in memory of caller, like sc_iterator3_f_a_a_new does
+_SC_EXTERN sc_iterator3 * sc_iterator3_f_a_a_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_addr el,
+    sc_type arc_type,
+    sc_type end_type);
+
+//! Initializes iterator in memory of caller, like sc_iterator3_a_a_f_new does
+_SC_EXTERN sc_iterator3 * sc_iterator3_a_a_f_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_type arc_type,
+    sc_addr el);
+
+//! Initializes iterator in memory of caller, like sc_iterator3_f_a_f_new does
+_SC_EXTERN sc_iterator3 * sc_iterator3_f_a_f_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_addr el_beg,
+    sc_type arc_type,
+    sc_addr el_end);
+
+//! Initializes iterator in memory of caller, like sc_iterator3_a_f_a_new does
+_SC_EXTERN sc_iterator3 * sc_iterator3_a_f_a_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_addr arc_addr,
+    sc_type end_type);
+
+//! Initializes iterator in memory of caller, like sc_iterator3_f_f_a_new does
+_SC_EXTERN sc_iterator3 * sc_iterator3_f_f_a_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_addr beg_addr,
+    sc_addr edge_addr,
+    sc_type end_type);
+
+//! Initializes iterator in memory of caller, like sc_iterator3_a_f_f_new does
+_SC_EXTERN sc_iterator3 * sc_iterator3_a_f_f_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type beg_type,
+    sc_addr edge_addr,
+    sc_addr end_addr);
+
+//! Initializes iterator in memory of caller, like sc_iterator3_f_f_f_new does
+_SC_EXTERN sc_iterator3 * sc_iterator3_f_f_f_init(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_addr beg_addr,
+    sc_addr edge_addr,
+    sc_addr end_addr);
+
+/*! Destroy iterator, that was initialized by sc_iterator3_init, without freeing of its memory
+ * @param it Pointer to sc-iterator that need to be destroyed
+ * @note Iterator can be destroyed by any thread. Iterator, that isn't finished, delays recycling of all erased
+ * sc-elements, so it shouldn't be kept alive after walk
+ */
+_SC_EXTERN void sc_iterator3_destroy(sc_iterator3 * it);
+
 /*! Destroy iterator and free allocated memory
  * @param it Pointer to sc-iterator that need to be destroyed
+ * @note Iterator, that isn't finished, delays recycling of all erased sc-elements as sc_iterator3_destroy describes
  */
 _SC_EXTERN void sc_iterator3_free(sc_iterator3 * it);
 
@@ -137,6 +232,64 @@ _SC_EXTERN void sc_iterator3_free(sc_iterator3 * it);
  */
 _SC_EXTERN sc_bool sc_iterator3_next(sc_iterator3 * it);
 
+/*! Go to next iterator results and get up to max_count of them at once
+ * @param it Pointer to iterator that we need to go next results
+ * @param results Pointer to array of 3 * max_count sc-addrs, results are stored in it by triples
+ * @param max_count Maximum number of triples to get
+ * @return Return number of stored triples. If it's less than max_count, then iterator is finished.
+ * example: while((count = sc_iterator3_next_batch(it, results, SC_ITERATOR_BATCH_SIZE)) > 0) { <your code> }
+ */
+_SC_EXTERN sc_uint32 sc_iterator3_next_batch(sc_iterator3 * it, sc_addr * results, sc_uint32 max_count);
+
+/*! Makes iterator walk arcs list from the last arc to the first one, so arcs are walked in order of their creation.
+ * The last arc is found by walk through the whole list once. It must be called before the first sc_iterator3_next
+ * and sc_iterator3_seek.
+ * @param it Pointer to sc_iterator3_f_a_a, sc_iterator3_a_a_f or sc_iterator3_f_a_f iterator
+ * @return Return SC_RESULT_OK, if iterator will walk arcs backward; SC_RESULT_ERROR_INVALID_PARAMS, if iterator of
+ * this type doesn't walk arcs list or walk is already started
+ */
+_SC_EXTERN sc_result sc_iterator3_set_reverse(sc_iterator3 * it);
+
+/*! Gets position of iterator after its current result
+ * @param it Pointer to iterator, that walks arcs list
+ * @param cursor Pointer to result container
+ * @return Return SC_TRUE, if iterator has current result; otherwise return SC_FALSE
+ */
+_SC_EXTERN sc_bool sc_iterator3_get_cursor(sc_iterator3 const * it, sc_iterator3_cursor * cursor);
+
+/*! Moves iterator to position of cursor, so sc_iterator3_next continues walk from arc, that is next to cursor arc.
+ * Cursor is valid, while its arc isn't erased. Arcs, that were added before cursor arc, aren't walked by resumed
+ * forward iterator, and arcs, that were added after it, are walked by resumed reverse iterator.
+ * @param it Pointer to iterator with the same parameters and direction as iterator, that cursor was got from
+ * @param cursor Pointer to cursor, that was got by sc_iterator3_get_cursor
+ * @return Return SC_RESULT_OK, if iterator was moved; SC_RESULT_ERROR_INVALID_PARAMS, if iterator of this type doesn't
+ * walk arcs list; SC_RESULT_ERROR_NOT_FOUND, if cursor arc was erased or doesn't belong to iterator arcs list
+ */
+_SC_EXTERN sc_result sc_iterator3_seek(sc_iterator3 * it, sc_iterator3_cursor const * cursor);
+
+//! Callback of parallel walk, that gets triple of results found by thread with specified index
+typedef void (*sc_iterator3_walk_callback)(sc_uint32 thread_index, sc_addr const * results, sc_pointer data);
+
+/*! Walks all remaining iterator results by several threads. Arcs list of fixed sc-element is collected by calling
+ * thread into chunks of SC_ITERATOR_PARALLEL_CHUNK_SIZE arcs, that are taken by workers of shared thread pool, while
+ * the next ones are collected. Then calling thread takes remaining chunks too. Only sc_iterator3_f_a_a and
+ * sc_iterator3_a_a_f iterators are walked in parallel, others are walked by calling thread.
+ * @param it Pointer to iterator to walk. It is finished after walk
+ * @param threads_count Number of threads including calling one. If it's 0, then number of processors is used
+ * @param callback Function, that is called for each result. It's called concurrently with different thread indices
+ * from [0, threads_count), so it should store results of each thread separately
+ * @param data Pointer, that is passed to callback
+ * @return Return number of walked results
+ */
+_SC_EXTERN sc_uint32 sc_iterator3_parallel_walk(
+    sc_iterator3 * it,
+    sc_uint32 threads_count,
+    sc_iterator3_walk_callback callback,
+    sc_pointer data);
+
+//! Stops workers of parallel walks, it's called on storage shutdown
+void sc_iterator3_parallel_walk_shutdown();
+
 /*! Get iterator value
  * @param it Pointer to iterator for getting value
  * @param vid Value id (can't be more that 3 for sc-iterator3)
@@ -10,7 +10,8 @@
 #include "sc-base/sc_allocator.h"
 #include "sc-base/sc_assert_utils.h"
 
-sc_iterator5 * sc_iterator5_new(
+sc_iterator5 * sc_iterator5_init(
+    sc_iterator5 * it,
     const sc_memory_context * ctx,
     sc_iterator5_type type,
     sc_iterator_param p1,
@@ -50,14 +51,16 @@ sc_iterator5 * sc_iterator5_new(
     return null_ptr;
   }
 
-  sc_iterator5 * it = sc_mem_new(sc_iterator5, 1);
-
   it->params[0] = p1;
   it->params[1] = p2;
   it->params[2] = p3;
   it->params[3] = p4;
   it->params[4] = p5;
 
+  // results, that aren't fixed, are empty until the first step
+  for (sc_uint8 i = 0; i < 5; ++i)
+    SC_ADDR_MAKE_EMPTY(it->results[i]);
+
   it->type = type;
   it->ctx = ctx;
 
@@ -65,52 +68,69 @@ sc_iterator5 * sc_iterator5_new(
   switch (type)
   {
   case sc_iterator5_f_a_a_a_f:
-    it->it_main = sc_iterator3_f_a_a_new(ctx, p1.addr, p2.type, p3.type);
+    it->it_main = sc_iterator3_f_a_a_init(&it->main_storage, ctx, p1.addr, p2.type, p3.type);
     it->it_attr = null_ptr;
     it->results[0] = p1.addr;
     it->results[4] = p5.addr;
     break;
   case sc_iterator5_a_a_f_a_f:
-    it->it_main = sc_iterator3_a_a_f_new(ctx, p1.type, p2.type, p3.addr);
+    it->it_main = sc_iterator3_a_a_f_init(&it->main_storage, ctx, p1.type, p2.type, p3.addr);
     it->it_attr = null_ptr;
     it->results[2] = p3.addr;
     it->results[4] = p5.addr;
     break;
   case sc_iterator5_f_a_f_a_f:
-    it->it_main = sc_iterator3_f_a_f_new(ctx, p1.addr, p2.type, p3.addr);
+    it->it_main = sc_iterator3_f_a_f_init(&it->main_storage, ctx, p1.addr, p2.type, p3.addr);
     it->it_attr = null_ptr;
     it->results[0] = p1.addr;
     it->results[2] = p3.addr;
     it->results[4] = p5.addr;
     break;
   case sc_iterator5_f_a_f_a_a:
-    it->it_main = sc_iterator3_f_a_f_new(ctx, p1.addr, p2.type, p3.addr);
+    it->it_main = sc_iterator3_f_a_f_init(&it->main_storage, ctx, p1.addr, p2.type, p3.addr);
     it->it_attr = null_ptr;
     it->results[0] = p1.addr;
     it->results[2] = p3.addr;
     break;
   case sc_iterator5_a_a_f_a_a:
-    it->it_main = sc_iterator3_a_a_f_new(ctx, p1.type, p2.type, p3.addr);
+    it->it_main = sc_iterator3_a_a_f_init(&it->main_storage, ctx, p1.type, p2.type, p3.addr);
     it->it_attr = null_ptr;
     it->results[2] = p3.addr;
     break;
   case sc_iterator5_f_a_a_a_a:
-    it->it_main = sc_iterator3_f_a_a_new(ctx, p1.addr, p2.type, p3.type);
+    it->it_main = sc_iterator3_f_a_a_init(&it->main_storage, ctx, p1.addr, p2.type, p3.type);
     it->it_attr = null_ptr;
     it->results[0] = p1.addr;
     break;
   }
 
   if (it->it_main == null_ptr)
+    return null_ptr;
+
+  return it;
+}
+
+sc_iterator5 * sc_iterator5_new(
+    const sc_memory_context * ctx,
+    sc_iterator5_type type,
+    sc_iterator_param p1,
+    sc_iterator_param p2,
+    sc_iterator_param p3,
+    sc_iterator_param p4,
+    sc_iterator_param p5)
+{
+  sc_iterator5 * it = sc_mem_new(sc_iterator5, 1);
+  if (sc_iterator5_init(it, ctx, type, p1, p2, p3, p4, p5) == null_ptr)
   {
     sc_mem_free(it);
-    it = 0;
+    return null_ptr;
   }
 
   return it;
 }
 
-sc_iterator5 * sc_iterator5_f_a_a_a_f_new(
+sc_iterator5 * sc_iterator5_f_a_a_a_f_init(
+    sc_iterator5 * it,
     const sc_memory_context * ctx,
     sc_addr p1,
     sc_type p2,
@@ -130,10 +150,11 @@ sc_iterator5 * sc_iterator5_f_a_a_a_f_new(
   _p5.is_type = SC_FALSE;
   _p5.addr = p5;
 
-  return sc_iterator5_new(ctx, sc_iterator5_f_a_a_a_f, _p1, _p2, _p3, _p4, _p5);
+  return sc_iterator5_init(it, ctx, sc_iterator5_f_a_a_a_f, _p1, _p2, _p3, _p4, _p5);
 }
 
-sc_iterator5 * sc_iterator5_a_a_f_a_f_new(
+sc_iterator5 * sc_iterator5_a_a_f_a_f_init(
+    sc_iterator5 * it,
     const sc_memory_context * ctx,
     sc_type p1,
     sc_type p2,
@@ -153,10 +174,11 @@ sc_iterator5 * sc_iterator5_a_a_f_a_f_new(
   _p5.is_type = SC_FALSE;
   _p5.addr = p5;
 
-  return sc_iterator5_new(ctx, sc_iterator5_a_a_f_a_f, _p1, _p2, _p3, _p4, _p5);
+  return sc_iterator5_init(it, ctx, sc_iterator5_a_a_f_a_f, _p1, _p2, _p3, _p4, _p5);
 }
 
-sc_iterator5 * sc_iterator5_f_a_f_a_f_new(
+sc_iterator5 * sc_iterator5_f_a_f_a_f_init(
+    sc_iterator5 * it,
     const sc_memory_context * ctx,
     sc_addr p1,
     sc_type p2,
@@ -176,10 +198,11 @@ sc_iterator5 * sc_iterator5_f_a_f_a_f_new(
   _p5.is_type = SC_FALSE;
   _p5.addr = p5;
 
-  return sc_iterator5_new(ctx, sc_iterator5_f_a_f_a_f, _p1, _p2, _p3, _p4, _p5);
+  return sc_iterator5_init(it, ctx, sc_iterator5_f_a_f_a_f, _p1, _p2, _p3, _p4, _p5);
 }
 
-sc_iterator5 * sc_iterator5_f_a_f_a_a_new(
+sc_iterator5 * sc_iterator5_f_a_f_a_a_init(
+    sc_iterator5 * it,
     const sc_memory_context * ctx,
     sc_addr p1,
     sc_type p2,
@@ -199,10 +222,11 @@ sc_iterator5 * sc_iterator5_f_a_f_a_a_new(
   _p5.is_type = SC_TRUE;
   _p5.type = p5;
 
-  return sc_iterator5_new(ctx, sc_iterator5_f_a_f_a_a, _p1, _p2, _p3, _p4, _p5);
+  return sc_iterator5_init(it, ctx, sc_iterator5_f_a_f_a_a, _p1, _p2, _p3, _p4, _p5);
 }
 
-sc_iterator5 * sc_iterator5_f_a_a_a_a_new(
+sc_iterator5 * sc_iterator5_f_a_a_a_a_init(
+    sc_iterator5 * it,
     const sc_memory_context * ctx,
     sc_addr p1,
     sc_type p2,
@@ -222,10 +246,11 @@ sc_iterator5 * sc_iterator5_f_a_a_a_a_new(
   _p5.is_type = SC_TRUE;
   _p5.type = p5;
 
-  return sc_iterator5_new(ctx, sc_iterator5_f_a_a_a_a, _p1, _p2, _p3, _p4, _p5);
+  return sc_iterator5_init(it, ctx, sc_iterator5_f_a_a_a_a, _p1, _p2, _p3, _p4, _p5);
 }
 
-sc_iterator5 * sc_iterator5_a_a_f_a_a_new(
+sc_iterator5 * sc_iterator5_a_a_f_a_a_init(
+    sc_iterator5 * it,
     const sc_memory_context * ctx,
     sc_type p1,
     sc_type p2,
@@ -245,18 +270,134 @@ sc_iterator5 * sc_iterator5_a_a_f_a_a_new(
   _p5.is_type = SC_TRUE;
   _p5.type = p5;
 
-  return sc_iterator5_new(ctx, sc_iterator5_a_a_f_a_a, _p1, _p2, _p3, _p4, _p5);
+  return sc_iterator5_init(it, ctx, sc_iterator5_a_a_f_a_a, _p1, _p2, _p3, _p4, _p5);
 }
 
-void sc_iterator5_free(sc_iterator5 * it)
+sc_iterator5 * sc_iterator5_f_a_a_a_f_new(
+    const sc_memory_context * ctx,
+    sc_addr p1,
+    sc_type p2,
+    sc_type p3,
+    sc_type p4,
+    sc_addr p5)
+{
+  sc_iterator5 * it = sc_mem_new(sc_iterator5, 1);
+  if (sc_iterator5_f_a_a_a_f_init(it, ctx, p1, p2, p3, p4, p5) == null_ptr)
+  {
+    sc_mem_free(it);
+    return null_ptr;
+  }
+
+  return it;
+}
+
+sc_iterator5 * sc_iterator5_a_a_f_a_f_new(
+    const sc_memory_context * ctx,
+    sc_type p1,
+    sc_type p2,
+    sc_addr p3,
+    sc_type p4,
+    sc_addr p5)
+{
+  sc_iterator5 * it = sc_mem_new(sc_iterator5, 1);
+  if (sc_iterator5_a_a_f_a_f_init(it, ctx, p1, p2, p3, p4, p5) == null_ptr)
+  {
+    sc_mem_free(it);
+    return null_ptr;
+  }
+
+  return it;
+}
+
+sc_iterator5 * sc_iterator5_f_a_f_a_f_new(
+    const sc_memory_context * ctx,
+    sc_addr p1,
+    sc_type p2,
+    sc_addr p3,
+    sc_type p4,
+    sc_addr p5)
+{
+  sc_iterator5 * it = sc_mem_new(sc_iterator5, 1);
+  if (sc_iterator5_f_a_f_a_f_init(it, ctx, p1, p2, p3, p4, p5) == null_ptr)
+  {
+    sc_mem_free(it);
+    return null_ptr;
+  }
+
+  return it;
+}
+
+sc_iterator5 * sc_iterator5_f_a_f_a_a_new(
+    const sc_memory_context * ctx,
+    sc_addr p1,
+    sc_type p2,
+    sc_addr p3,
+    sc_type p4,
+    sc_type p5)
+{
+  sc_iterator5 * it = sc_mem_new(sc_iterator5, 1);
+  if (sc_iterator5_f_a_f_a_a_init(it, ctx, p1, p2, p3, p4, p5) == null_ptr)
+  {
+    sc_mem_free(it);
+    return null_ptr;
+  }
+
+  return it;
+}
+
+sc_iterator5 * sc_iterator5_f_a_a_a_a_new(
+    const sc_memory_context * ctx,
+    sc_addr p1,
+    sc_type p2,
+    sc_type p3,
+    sc_type p4,
+    sc_type p5)
+{
+  sc_iterator5 * it = sc_mem_new(sc_iterator5, 1);
+  if (sc_iterator5_f_a_a_a_a_init(it, ctx, p1, p2, p3, p4, p5) == null_ptr)
+  {
+    sc_mem_free(it);
+    return null_ptr;
+  }
+
+  return it;
+}
+
+sc_iterator5 * sc_iterator5_a_a_f_a_a_new(
+    const sc_memory_context * ctx,
+    sc_type p1,
+    sc_type p2,
+    sc_addr p3,
+    sc_type p4,
+    sc_type p5)
+{
+  sc_iterator5 * it = sc_mem_new(sc_iterator5, 1);
+  if (sc_iterator5_a_a_f_a_a_init(it, ctx, p1, p2, p3, p4, p5) == null_ptr)
+  {
+    sc_mem_free(it);
+    return null_ptr;
+  }
+
+  return it;
+}
+
+void sc_iterator5_destroy(sc_iterator5 * it)
 {
   if (it == null_ptr)
     return;
 
   if (it->it_attr != null_ptr)
-    sc_iterator3_free(it->it_attr);
+    sc_iterator3_destroy(it->it_attr);
   if (it->it_main != null_ptr)
-    sc_iterator3_free(it->it_main);
+    sc_iterator3_destroy(it->it_main);
+}
+
+void sc_iterator5_free(sc_iterator5 * it)
+{
+  if (it == null_ptr)
+    return;
+
+  sc_iterator5_destroy(it);
   sc_mem_free(it);
 }
 
@@ -277,7 +418,7 @@ sc_bool _sc_iterator5_a_a_f_a_f_next(sc_iterator5 * it)
   {
     if (it->it_attr != null_ptr)
     {
-      sc_iterator3_free(it->it_attr);
+      sc_iterator3_destroy(it->it_attr);
       it->it_attr = null_ptr;
     }
 
@@ -285,14 +426,15 @@ sc_bool _sc_iterator5_a_a_f_a_f_next(sc_iterator5 * it)
     {
       if (it->it_attr != null_ptr)
       {
-        sc_iterator3_free(it->it_attr);
+        sc_iterator3_destroy(it->it_attr);
         it->it_attr = null_ptr;
       }
 
       if (!sc_iterator3_next(it->it_main))
         return SC_FALSE;
 
-      it->it_attr = sc_iterator3_f_a_f_new(it->ctx, it->params[4].addr, it->params[3].type, it->it_main->results[1]);
+      it->it_attr = sc_iterator3_f_a_f_init(
+          &it->attr_storage, it->ctx, it->params[4].addr, it->params[3].type, it->it_main->results[1]);
       if (it->it_attr == null_ptr)
         return SC_FALSE;
     }
@@ -320,7 +462,7 @@ sc_bool _sc_iterator5_f_a_a_a_f_next(sc_iterator5 * it)
   {
     if (it->it_attr != null_ptr)
     {
-      sc_iterator3_free(it->it_attr);
+      sc_iterator3_destroy(it->it_attr);
       it->it_attr = null_ptr;
     }
 
@@ -328,14 +470,15 @@ sc_bool _sc_iterator5_f_a_a_a_f_next(sc_iterator5 * it)
     {
       if (it->it_attr != null_ptr)
       {
-        sc_iterator3_free(it->it_attr);
+        sc_iterator3_destroy(it->it_attr);
         it->it_attr = null_ptr;
       }
 
       if (!sc_iterator3_next(it->it_main))
         return SC_FALSE;
 
-      it->it_attr = sc_iterator3_f_a_f_new(it->ctx, it->params[4].addr, it->params[3].type, it->it_main->results[1]);
+      it->it_attr = sc_iterator3_f_a_f_init(
+          &it->attr_storage, it->ctx, it->params[4].addr, it->params[3].type, it->it_main->results[1]);
       if (it->it_attr == null_ptr)
         return SC_FALSE;
     }
@@ -361,7 +504,7 @@ sc_bool _sc_iterator5_f_a_f_a_f_next(sc_iterator5 * it)
   {
     if (it->it_attr != null_ptr)
     {
-      sc_iterator3_free(it->it_attr);
+      sc_iterator3_destroy(it->it_attr);
       it->it_attr = null_ptr;
     }
 
@@ -369,14 +512,15 @@ sc_bool _sc_iterator5_f_a_f_a_f_next(sc_iterator5 * it)
     {
       if (it->it_attr != null_ptr)
       {
-        sc_iterator3_free(it->it_attr);
+        sc_iterator3_destroy(it->it_attr);
         it->it_attr = null_ptr;
       }
 
       if (!sc_iterator3_next(it->it_main))
         return SC_FALSE;
 
-      it->it_attr = sc_iterator3_f_a_f_new(it->ctx, it->params[4].addr, it->params[3].type, it->it_main->results[1]);
+      it->it_attr = sc_iterator3_f_a_f_init(
+          &it->attr_storage, it->ctx, it->params[4].addr, it->params[3].type, it->it_main->results[1]);
       if (it->it_attr == null_ptr)
         return SC_FALSE;
     }
@@ -403,7 +547,7 @@ sc_bool _sc_iterator5_f_a_f_a_a_next(sc_iterator5 * it)
   {
     if (it->it_attr != null_ptr)
     {
-      sc_iterator3_free(it->it_attr);
+      sc_iterator3_destroy(it->it_attr);
       it->it_attr = null_ptr;
     }
 
@@ -411,14 +555,15 @@ sc_bool _sc_iterator5_f_a_f_a_a_next(sc_iterator5 * it)
     {
       if (it->it_attr != null_ptr)
       {
-        sc_iterator3_free(it->it_attr);
+        sc_iterator3_destroy(it->it_attr);
         it->it_attr = null_ptr;
       }
 
       if (!sc_iterator3_next(it->it_main))
         return SC_FALSE;
 
-      it->it_attr = sc_iterator3_a_a_f_new(it->ctx, it->params[4].type, it->params[3].type, it->it_main->results[1]);
+      it->it_attr = sc_iterator3_a_a_f_init(
+          &it->attr_storage, it->ctx, it->params[4].type, it->params[3].type, it->it_main->results[1]);
       if (it->it_attr == null_ptr)
         return SC_FALSE;
     }
@@ -448,7 +593,7 @@ sc_bool _sc_iterator5_f_a_a_a_a_next(sc_iterator5 * it)
   {
     if (it->it_attr != null_ptr)
     {
-      sc_iterator3_free(it->it_attr);
+      sc_iterator3_destroy(it->it_attr);
       it->it_attr = null_ptr;
     }
 
@@ -456,14 +601,15 @@ sc_bool _sc_iterator5_f_a_a_a_a_next(sc_iterator5 * it)
     {
       if (it->it_attr != null_ptr)
       {
-        sc_iterator3_free(it->it_attr);
+        sc_iterator3_destroy(it->it_attr);
         it->it_attr = null_ptr;
       }
 
       if (!sc_iterator3_next(it->it_main))
         return SC_FALSE;
 
-      it->it_attr = sc_iterator3_a_a_f_new(it->ctx, it->params[4].type, it->params[3].type, it->it_main->results[1]);
+      it->it_attr = sc_iterator3_a_a_f_init(
+          &it->attr_storage, it->ctx, it->params[4].type, it->params[3].type, it->it_main->results[1]);
       if (it->it_attr == null_ptr)
         return SC_FALSE;
     }
@@ -494,7 +640,7 @@ sc_bool _sc_iterator5_a_a_f_a_a_next(sc_iterator5 * it)
   {
     if (it->it_attr != null_ptr)
     {
-      sc_iterator3_free(it->it_attr);
+      sc_iterator3_destroy(it->it_attr);
       it->it_attr = null_ptr;
     }
 
@@ -502,13 +648,14 @@ sc_bool _sc_iterator5_a_a_f_a_a_next(sc_iterator5 * it)
     {
       if (it->it_attr != null_ptr)
       {
-        sc_iterator3_free(it->it_attr);
+        sc_iterator3_destroy(it->it_attr);
         it->it_attr = null_ptr;
       }
       if (!sc_iterator3_next(it->it_main))
         return SC_FALSE;
 
-      it->it_attr = sc_iterator3_a_a_f_new(it->ctx, it->params[4].type, it->params[3].type, it->it_main->results[1]);
+      it->it_attr = sc_iterator3_a_a_f_init(
+          &it->attr_storage, it->ctx, it->params[4].type, it->params[3].type, it->it_main->results[1]);
       if (it->it_attr == null_ptr)
         return SC_FALSE;
     }
@@ -27,10 +27,12 @@ struct _sc_iterator5
   sc_iterator5_type type;         // iterator type (search template)
   sc_iterator_param params[5];    // parameters array
   sc_addr results[5];             // results array (same size as params)
-  sc_iterator3 * it_main;         // iterator of main arc
-  sc_iterator3 * it_attr;         // iterator of attribute arc
+  sc_iterator3 * it_main;         // iterator of main arc, it points to main_storage
+  sc_iterator3 * it_attr;         // iterator of attribute arc, it points to attr_storage
   sc_uint32 time_stamp;           // iterator time stamp
   const sc_memory_context * ctx;  // pointer to used memory context
+  sc_iterator3 main_storage;      // iterators are stored inside, so iterator can't be copied
+  sc_iterator3 attr_storage;
 };
 
 typedef struct _sc_iterator5 sc_iterator5;
@@ -152,6 +154,82 @@ _SC_EXTERN sc_iterator5 * sc_iterator5_a_a_f_a_a_new(
     sc_type p4,
     sc_type p5);
 
+/*! Initialize sc-iterator5 in memory of caller, for example on stack, so neither it nor its internal iterators
+ * are allocated in heap
+ * @param it Pointer to memory for iterator
+ * @return Return it, if iterator initialized; otherwise return 0. Initialized iterator must be destroyed by
+ * sc_iterator5_destroy.
+ */
+_SC_EXTERN sc_iterator5 * sc_iterator5_init(
+    sc_iterator5 * it,
+    const sc_memory_context * ctx,
+    sc_iterator5_type type,
+    sc_iterator_param p1,
+    sc_iterator_param p2,
+    sc_iterator_param p3,
+    sc_iterator_param p4,
+    sc_iterator_param p5);
+
+//! Initializes iterator in memory of caller, like sc_iterator5_f_a_a_a_f_new does
+_SC_EXTERN sc_iterator5 * sc_iterator5_f_a_a_a_f_init(
+    sc_iterator5 * it,
+    const sc_memory_context * ctx,
+    sc_addr p1,
+    sc_type p2,
+    sc_type p3,
+    sc_type p4,
+    sc_addr p5);
+
+//! Initializes iterator in memory of caller, like sc_iterator5_a_a_f_a_f_new does
+_SC_EXTERN sc_iterator5 * sc_iterator5_a_a_f_a_f_init(
+    sc_iterator5 * it,
+    const sc_memory_context * ctx,
+    sc_type p1,
+    sc_type p2,
+    sc_addr p3,
+    sc_type p4,
+    sc_addr p5);
+
+//! Initializes iterator in memory of caller, like sc_iterator5_f_a_f_a_f_new does
+_SC_EXTERN sc_iterator5 * sc_iterator5_f_a_f_a_f_init(
+    sc_iterator5 * it,
+    const sc_memory_context * ctx,
+    sc_addr p1,
+    sc_type p2,
+    sc_addr p3,
+    sc_type p4,
+    sc_addr p5);
+
+//! Initializes iterator in memory of caller, like sc_iterator5_f_a_f_a_a_new does
+_SC_EXTERN sc_iterator5 * sc_iterator5_f_a_f_a_a_init(
+    sc_iterator5 * it,
+    const sc_memory_context * ctx,
+    sc_addr p1,
+    sc_type p2,
+    sc_addr p3,
+    sc_type p4,
+    sc_type p5);
+
+//! Initializes iterator in memory of caller, like sc_iterator5_f_a_a_a_a_new does
+_SC_EXTERN sc_iterator5 * sc_iterator5_f_a_a_a_a_init(
+    sc_iterator5 * it,
+    const sc_memory_context * ctx,
+    sc_addr p1,
+    sc_type p2,
+    sc_type p3,
+    sc_type p4,
+    sc_type p5);
+
+//! Initializes iterator in memory of caller, like sc_iterator5_a_a_f_a_a_new does
+_SC_EXTERN sc_iterator5 * sc_iterator5_a_a_f_a_a_init(
+    sc_iterator5 * it,
+    const sc_memory_context * ctx,
+    sc_type p1,
+    sc_type p2,
+    sc_addr p3,
+    sc_type p4,
+    sc_type p5);
+
 /*! Go to next iterator result
  * @param it Pointer to iterator that we need to go next result
  * @return Return SC_TRUE, if iterator moved to new results; otherwise return SC_FALSE.
@@ -166,6 +244,11 @@ _SC_EXTERN sc_bool sc_iterator5_next(sc_iterator5 * it);
  */
 _SC_EXTERN sc_addr sc_iterator5_value(sc_iterator5 * it, sc_uint vid);
 
+/*! Destroy iterator, that was initialized by sc_iterator5_init, without freeing of its memory
+ * @param it Pointer to sc-iterator that need to be destroyed
+ */
+_SC_EXTERN void sc_iterator5_destroy(sc_iterator5 * it);
+
 /*! Destroy iterator and free allocated memory
  * @param it Pointer to sc-iterator that need to be destroyed
  */
@@ -12,29 +12,210 @@
 #include "sc-base/sc_allocator.h"
 #include "sc-base/sc_atomic.h"
 #include "sc-base/sc_assert_utils.h"
+#include "sc-base/sc_bits.h"
+#include "sc-base/sc_spin.h"
+
+#if SC_IS_PLATFORM_WIN32
+#  include <windows.h>
+#else
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+// Offsets are mapped into slot positions by multiplication with odd number modulo 2^16, that is a permutation.
+// High bits of position are section index, so neighbour offsets are spread over sections
+#define SC_SEGMENT_POSITION_MULTIPLIER 0x9E3Bu
+#define SC_SEGMENT_POSITION_MULTIPLIER_INVERSE 0x8AF3u
+#define SC_SEGMENT_POSITION_MASK ((1u << SC_SEGMENT_SLOTS_BITS) - 1)
+
+#define SC_SEGMENT_OFFSET_TO_POSITION(offset) \
+  (((sc_uint32)(offset)*SC_SEGMENT_POSITION_MULTIPLIER) & SC_SEGMENT_POSITION_MASK)
+#define SC_SEGMENT_POSITION_TO_OFFSET(position) \
+  (((sc_uint32)(position)*SC_SEGMENT_POSITION_MULTIPLIER_INVERSE) & SC_SEGMENT_POSITION_MASK)
+
+// Number of sections, that can be locked for reading by one thread at the same time without growth of its list
+#define SC_SEGMENT_SHARED_LOCKS_INITIAL_CAPACITY 8
+
+//! Shared lock of section by thread with count of its recursive locks
+typedef struct _sc_segment_shared_lock
+{
+  sc_segment_section * section;
+  sc_uint32 depth;
+} sc_segment_shared_lock;
 
-sc_segment * sc_segment_new(sc_addr_seg num)
+//! Sections, that are locked for reading by thread. List is grown, so all of them are tracked
+typedef struct _sc_segment_shared_locks
+{
+  sc_segment_shared_lock * locks;
+  sc_uint32 count;
+  sc_uint32 capacity;
+} sc_segment_shared_locks;
+
+void _sc_segment_shared_locks_free(gpointer data)
+{
+  sc_segment_shared_locks * locks = data;
+  sc_mem_free(locks->locks);
+  sc_mem_free(locks);
+}
+
+// shared locks of current thread, they are allocated on the first shared lock of thread
+GPrivate s_segment_shared_locks = G_PRIVATE_INIT(_sc_segment_shared_locks_free);
+
+sc_uint32 s_sections_count = SC_CONCURRENCY_LEVEL;
+// log2 of slots count in each of SC_CONCURRENCY_LEVEL sections
+sc_uint32 s_section_slots_bits = SC_SEGMENT_SLOTS_BITS - 5;
+
+sc_uint32 sc_segment_set_concurrency_level(sc_uint32 level)
+{
+  sc_uint32 bits = 0;
+  while ((1u << bits) < level && (1u << bits) < SC_CONCURRENCY_LEVEL_MAX)
+    ++bits;
+
+  s_sections_count = 1u << bits;
+  s_section_slots_bits = SC_SEGMENT_SLOTS_BITS - bits;
+
+  return s_sections_count;
+}
+
+sc_uint32 sc_segment_get_sections_count()
+{
+  return s_sections_count;
+}
+
+sc_segment_section * sc_segment_get_section(sc_segment * seg, sc_addr_offset offset)
+{
+  return &seg->sections[SC_SEGMENT_OFFSET_TO_POSITION(offset) >> s_section_slots_bits];
+}
+
+//! Returns the first word of segment empty_mask, that stores slots of specified section
+sc_int _sc_segment_section_first_word(sc_uint32 section_idx)
+{
+  return (sc_int)((section_idx << s_section_slots_bits) >> 6);
+}
+
+//! Returns the word of segment empty_mask after the last one, that stores slots of specified section
+sc_int _sc_segment_section_end_word(sc_uint32 section_idx)
 {
-  sc_segment * segment = sc_mem_new(sc_segment, 1);
+  return (sc_int)(((section_idx + 1) << s_section_slots_bits) >> 6);
+}
+
+//! Marks slot with specified offset as empty in segment bitmap. @note section need to be locked
+void _sc_segment_set_empty(sc_segment * seg, sc_segment_section * section, sc_addr_offset offset)
+{
+  sc_uint32 const position = SC_SEGMENT_OFFSET_TO_POSITION(offset);
+  sc_int const word = (sc_int)(position >> 6);
+  seg->empty_mask[word] |= ((sc_uint64)1 << (position & 63));
+  if (word < section->empty_word)
+    section->empty_word = word;
+}
+
+//! Marks slot with specified offset as used in segment bitmap. @note section need to be locked
+void _sc_segment_set_used(sc_segment * seg, sc_addr_offset offset)
+{
+  sc_uint32 const position = SC_SEGMENT_OFFSET_TO_POSITION(offset);
+  seg->empty_mask[position >> 6] &= ~((sc_uint64)1 << (position & 63));
+}
 
-  // initialize empty count for sections
-  sc_uint16 count = SC_SEGMENT_ELEMENTS_COUNT / SC_CONCURRENCY_LEVEL;
-  sc_uint16 i, c = count * SC_CONCURRENCY_LEVEL;
-  for (i = 0; i < SC_CONCURRENCY_LEVEL; ++i)
+/*! Returns offset of the first empty slot in section, or -1 if there are no empty slots.
+ * @note section need to be locked
+ */
+sc_int32 _sc_segment_section_find_empty(sc_segment * seg, sc_uint32 section_idx)
+{
+  sc_segment_section * section = &seg->sections[section_idx];
+  sc_int const end_word = _sc_segment_section_end_word(section_idx);
+  sc_int word;
+  for (word = section->empty_word; word < end_word; ++word)
   {
-    sc_segment_section * section = &(segment->sections[i]);
-    section->empty_offset = i;
-    section->empty_count = ((c + i) <= SC_SEGMENT_ELEMENTS_COUNT) ? count + 1 : count;
+    sc_uint64 const mask = seg->empty_mask[word];
+    if (mask != 0)
+    {
+      section->empty_word = word;
+      return (sc_int32)SC_SEGMENT_POSITION_TO_OFFSET(((sc_uint32)word << 6) + sc_bits_ctz64(mask));
+    }
   }
 
-  if (num == 0)
+  section->empty_word = end_word;
+  return -1;
+}
+
+//! Resets bitmap of empty slots, so all sections have no empty slots
+void _sc_segment_reset_empty(sc_segment * seg)
+{
+  sc_uint32 i;
+  for (i = 0; i < s_sections_count; ++i)
   {
-    segment->sections[0].empty_offset += SC_CONCURRENCY_LEVEL;
-    --segment->sections[0].empty_count;
+    sc_segment_section * section = &seg->sections[i];
+    section->empty_count = 0;
+    section->empty_word = _sc_segment_section_end_word(i);
   }
 
+  sc_mem_set(seg->empty_mask, 0, sizeof(seg->empty_mask));
+}
+
+/*! Allocates zeroed memory for segment. Memory is reserved from OS directly, so its pages are committed on first
+ * access and resident memory grows with number of used sc-elements, not with number of segments.
+ */
+sc_segment * _sc_segment_memory_alloc()
+{
+#if SC_IS_PLATFORM_WIN32
+  return (sc_segment *)VirtualAlloc(null_ptr, sizeof(sc_segment), MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+  void * memory = mmap(null_ptr, sizeof(sc_segment), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  return memory == MAP_FAILED ? null_ptr : (sc_segment *)memory;
+#endif
+}
+
+void _sc_segment_memory_free(sc_segment * segment)
+{
+#if SC_IS_PLATFORM_WIN32
+  VirtualFree(segment, 0, MEM_RELEASE);
+#else
+  munmap(segment, sizeof(sc_segment));
+#endif
+}
+
+//! Returns physical pages of [begin, begin + size) to OS. Pages are zeroed on next access
+void _sc_segment_memory_discard(void * begin, sc_uint64 size)
+{
+#if SC_IS_PLATFORM_WIN32
+  static sc_uint64 const page_size = 4096;
+#else
+  static sc_uint64 page_size = 0;
+  if (page_size == 0)
+    page_size = (sc_uint64)sysconf(_SC_PAGESIZE);
+#endif
+
+  // only whole pages can be returned
+  sc_uint64 const first = ((sc_uint64)GPOINTER_TO_SIZE(begin) + page_size - 1) & ~(page_size - 1);
+  sc_uint64 const last = ((sc_uint64)GPOINTER_TO_SIZE(begin) + size) & ~(page_size - 1);
+  if (first >= last)
+    return;
+
+#if SC_IS_PLATFORM_WIN32
+  VirtualFree(GSIZE_TO_POINTER(first), last - first, MEM_DECOMMIT);
+  VirtualAlloc(GSIZE_TO_POINTER(first), last - first, MEM_COMMIT, PAGE_READWRITE);
+#else
+  madvise(GSIZE_TO_POINTER(first), last - first, MADV_DONTNEED);
+#endif
+}
+
+sc_segment * sc_segment_new(sc_addr_seg num)
+{
+  sc_segment * segment = _sc_segment_memory_alloc();
+  if (segment == null_ptr)
+    return null_ptr;
   segment->num = num;
 
+  // all slots are empty, except the first one in the first segment (it is an empty sc-addr)
+  _sc_segment_reset_empty(segment);
+  sc_uint32 offset;
+  for (offset = (num == 0) ? 1 : 0; offset < SC_SEGMENT_ELEMENTS_COUNT; ++offset)
+  {
+    sc_segment_section * section = sc_segment_get_section(segment, offset);
+    _sc_segment_set_empty(segment, section, offset);
+    ++section->empty_count;
+  }
+
   return segment;
 }
 
@@ -42,24 +223,26 @@ void sc_segment_loaded(sc_segment * seg)
 {
   sc_uint32 i;
   seg->elements_count = 0;
+  _sc_segment_reset_empty(seg);
 
-  for (i = 0; i < SC_CONCURRENCY_LEVEL; ++i)
+  for (i = (seg->num == 0) ? 1 : 0; i < SC_SEGMENT_ELEMENTS_COUNT; ++i)
   {
-    sc_segment_section * section = &seg->sections[i];
-    sc_uint32 idx = i;
+    // sc-elements, that were erased, but weren't recycled before save (iterators used them), are recycled on load
+    if (seg->elements[i].flags.type & sc_flag_request_deletion)
+      sc_mem_set(&seg->elements[i], 0, sizeof(sc_element));
 
-    section->empty_count = 0;
-    while (idx < SC_SEGMENT_ELEMENTS_COUNT)
-    {
-      if (seg->elements[idx].flags.type == 0)
-      {
-        ++section->empty_count;
-        section->empty_offset = (sc_int32)idx;
-      }
-      else
-        ++seg->elements_count;
-      idx += SC_CONCURRENCY_LEVEL;
-    }
+    if (seg->elements[i].flags.type == 0)
+      _sc_segment_set_empty(seg, sc_segment_get_section(seg, i), i);
+    else
+      ++seg->elements_count;
+  }
+
+  sc_int w;
+  for (i = 0; i < s_sections_count; ++i)
+  {
+    sc_segment_section * section = &seg->sections[i];
+    for (w = _sc_segment_section_first_word(i); w < _sc_segment_section_end_word(i); ++w)
+      section->empty_count += sc_bits_popcount64(seg->empty_mask[w]);
   }
 
   // initialize references to 1
@@ -68,27 +251,77 @@ void sc_segment_loaded(sc_segment * seg)
     if (seg->elements[i].flags.type != 0)
       seg->meta[i].ref_count = 1;
   }
+
+#ifdef SC_SEGMENT_COLUMNS
+  for (i = 0; i < SC_SEGMENT_ELEMENTS_COUNT; ++i)
+  {
+    if (seg->elements[i].flags.type != 0)
+      sc_element_get_columns(&seg->elements[i], &seg->columns[i]);
+  }
+#endif
 }
 
 void sc_segment_free(sc_segment * segment)
 {
   sc_assert(segment != null_ptr);
 
-  sc_mem_free(segment);
+  _sc_segment_memory_free(segment);
+}
+
+sc_bool sc_segment_release_memory(sc_segment * seg)
+{
+  sc_assert(seg != null_ptr);
+
+  if (sc_atomic_int_get(&seg->elements_count) != 0)
+    return SC_FALSE;
+
+  // don't wait for sections, that are used by other threads: segment isn't empty in this case
+  sc_uint32 i, locked;
+  for (locked = 0; locked < s_sections_count; ++locked)
+  {
+    if (sc_segment_section_lock_try(&seg->sections[locked], 1) == SC_FALSE)
+      break;
+  }
+
+  sc_bool released = SC_FALSE;
+  if (locked == s_sections_count && sc_atomic_int_get(&seg->elements_count) == 0)
+  {
+    // all elements and their meta are zeroed already, so discarded pages will be read back as the same values
+#ifdef SC_SEGMENT_COLUMNS
+    _sc_segment_memory_discard(seg->columns, sizeof(seg->columns) + sizeof(seg->meta) + sizeof(seg->elements));
+#else
+    _sc_segment_memory_discard(seg->meta, sizeof(seg->meta) + sizeof(seg->elements));
+#endif
+#ifdef SC_ARC_TYPE_INDEX
+    _sc_segment_memory_discard(seg->typed_arcs, sizeof(seg->typed_arcs));
+#endif
+    released = SC_TRUE;
+  }
+
+  for (i = 0; i < locked; ++i)
+    sc_segment_section_unlock(&seg->sections[i]);
+
+  return released;
 }
 
 void sc_segment_erase_element(sc_segment * seg, sc_uint16 offset)
 {
-  sc_assert(sc_atomic_pointer_get((void **)&seg->sections[offset % SC_CONCURRENCY_LEVEL].thread_lock) != null_ptr);
+  sc_segment_section * section = sc_segment_get_section(seg, offset);
+  sc_assert(sc_atomic_pointer_get((void **)&section->thread_lock) != null_ptr);
   sc_atomic_int_dec_and_test(&seg->elements_count);
 
   sc_assert(seg != null_ptr);
   sc_assert(offset < SC_SEGMENT_ELEMENTS_COUNT);
   sc_mem_set(&seg->elements[offset], 0, sizeof(sc_element));
-
-  sc_segment_section * section = &(seg->sections[offset % SC_CONCURRENCY_LEVEL]);
+#ifdef SC_SEGMENT_COLUMNS
+  sc_mem_set(&seg->columns[offset], 0, sizeof(sc_element_columns));
+#endif
+#ifdef SC_ARC_TYPE_INDEX
+  sc_mem_set(&seg->typed_arcs[offset], 0, sizeof(sc_element_typed_arcs));
+#endif
+
+  _sc_segment_set_empty(seg, section, offset);
   sc_atomic_int_inc(&section->empty_count);
-  sc_atomic_int_set(&section->empty_offset, offset);
 
   sc_assert(offset != 0 || seg->num != 0);
 }
@@ -111,15 +344,23 @@ sc_bool sc_segment_has_empty_slot(sc_segment * segment)
 
 void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat)
 {
-  sc_int32 i;
-  for (i = 0; i < SC_CONCURRENCY_LEVEL; ++i)
+  sc_uint32 i;
+  for (i = 0; i < s_sections_count; ++i)
   {
     sc_segment_section * section = &seg->sections[i];
-    sc_segment_section_lock(section);
-    sc_int32 j = i;
-    while (j < SC_SEGMENT_ELEMENTS_COUNT)
+    sc_segment_section_lock_shared(section);
+    sc_uint32 position;
+    for (position = i << s_section_slots_bits; position < ((i + 1) << s_section_slots_bits); ++position)
     {
-      sc_type type = seg->elements[j].flags.type;
+      sc_uint32 const offset = SC_SEGMENT_POSITION_TO_OFFSET(position);
+      if (offset >= SC_SEGMENT_ELEMENTS_COUNT)
+        continue;
+
+      sc_type type = seg->elements[offset].flags.type;
+      // erased sc-element keeps its type, until it's recycled
+      if (type & sc_flag_request_deletion)
+        continue;
+
       if (type & sc_type_node)
         stat->node_count++;
       else if (type & sc_type_link)
@@ -132,104 +373,104 @@ void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat)
         if (type == 0)
           stat->empty_count++;
       }
-
-      j += SC_CONCURRENCY_LEVEL;
     }
-    sc_segment_section_unlock(section);
+    sc_segment_section_unlock_shared(section);
   }
 }
 
 sc_element_meta * sc_segment_get_meta(sc_segment * seg, sc_addr_offset offset)
 {
   sc_assert(seg != null_ptr);
-  sc_assert(seg->sections[offset % SC_CONCURRENCY_LEVEL].thread_lock == sc_thread());
+  sc_assert(sc_segment_get_section(seg, offset)->thread_lock == sc_thread());
   sc_assert(offset < SC_SEGMENT_ELEMENTS_COUNT);
 
   return &seg->meta[offset];
 }
 
+#ifdef SC_SEGMENT_COLUMNS
+void sc_segment_update_columns(sc_segment * seg, sc_addr_offset offset)
+{
+  sc_assert(seg != null_ptr);
+  sc_assert(offset < SC_SEGMENT_ELEMENTS_COUNT);
+
+  sc_element_get_columns(&seg->elements[offset], &seg->columns[offset]);
+}
+
+sc_element_columns const * sc_segment_get_columns(sc_segment * seg, sc_addr_offset offset)
+{
+  sc_assert(seg != null_ptr);
+  sc_assert(offset < SC_SEGMENT_ELEMENTS_COUNT);
+
+  return &seg->columns[offset];
+}
+#endif
+
 // ---------------------------
 sc_element * sc_segment_lock_empty_element(sc_memory_context const * ctx, sc_segment * seg, sc_addr_offset * offset)
+{
+  if (sc_segment_lock_empty_elements(ctx, seg, 1, offset) == 0)
+    return null_ptr;
+
+  return &seg->elements[*offset];
+}
+
+sc_uint32 sc_segment_lock_empty_elements(
+    sc_memory_context const * ctx,
+    sc_segment * seg,
+    sc_uint32 count,
+    sc_addr_offset * offsets)
 {
   sc_uint16 max_attempts = 1;
   while (sc_segment_has_empty_slot(seg) == SC_TRUE)
   {
     sc_uint32 i;
-    for (i = 0; i < SC_CONCURRENCY_LEVEL; ++i)
+    for (i = 0; i < s_sections_count; ++i)
     {
-      sc_uint32 sec_id = (ctx->id + i) % SC_CONCURRENCY_LEVEL;
+      sc_uint32 sec_id = (ctx->id + i) & (s_sections_count - 1);
       sc_segment_section * section = &seg->sections[sec_id];
 
       if (sc_atomic_int_get(&section->empty_count) == 0)
         continue;
 
-      sc_bool locked = sc_segment_section_lock_try(section, 1);
-
-      if (locked == SC_TRUE)
-      {
-        sc_int32 idx = (sc_int32)section->empty_offset;
-
-        if (section->empty_count > 0)
-        {
-          sc_atomic_int_inc(&seg->elements_count);
-          sc_atomic_int_add(&section->empty_count, -1);
-
-          // trying to find empty element in section
-          sc_assert(idx >= 0 && idx < SC_SEGMENT_ELEMENTS_COUNT);
-          sc_assert(seg->num + idx > 0);  // not empty addr
-
-          // need to find new empty element
-          sc_int32 j = idx + SC_CONCURRENCY_LEVEL;
-          while (j < SC_SEGMENT_ELEMENTS_COUNT)
-          {
-            if (seg->elements[j].flags.type == 0)
-            {
-              sc_atomic_int_set(&section->empty_offset, j);
-              sc_assert(seg->num + j > 0);
-              goto result;
-            }
-            j += SC_CONCURRENCY_LEVEL;
-          }
-          j = idx - SC_CONCURRENCY_LEVEL;
-          sc_int left = (i == 0 && seg->num == 0) ? SC_CONCURRENCY_LEVEL : idx;
-          while (j >= left)
-          {
-            if (seg->elements[j].flags.type == 0)
-            {
-              sc_atomic_int_set(&section->empty_offset, j);
-              sc_assert(seg->num + j > 0);
-              goto result;
-            }
-
-            j -= SC_CONCURRENCY_LEVEL;
-          }
-        }
-
-        sc_segment_section_unlock(section);
+      if (sc_segment_section_lock_try(section, max_attempts) == SC_FALSE)
         continue;
 
-      result:
+      // slots of section are taken in order of their positions, so they are neighbours in bitmap
+      sc_uint32 locked = 0;
+      while (locked < count && section->empty_count > 0)
       {
+        sc_int32 const idx = _sc_segment_section_find_empty(seg, sec_id);
+        sc_assert(idx >= 0 && idx < SC_SEGMENT_ELEMENTS_COUNT);
+        sc_assert(seg->num + idx > 0);  // not empty addr
+        sc_assert(seg->elements[idx].flags.type == 0);
+
+        _sc_segment_set_used(seg, idx);
+        sc_atomic_int_inc(&seg->elements_count);
+        sc_atomic_int_add(&section->empty_count, -1);
         sc_assert(sc_atomic_int_get(&section->empty_count) >= 0);
-        *offset = idx;
-        return &seg->elements[*offset];
-      }
+
+        offsets[locked++] = idx;
       }
+
+      if (locked > 0)
+        return locked;
+
+      sc_segment_section_unlock(section);
     }
 
     if (max_attempts < SC_CONCURRENCY_LEVEL)
       ++max_attempts;
     else
-      return null_ptr;
+      return 0;
   }
 
-  return null_ptr;
+  return 0;
 }
 
 sc_element * sc_segment_lock_element(sc_segment * seg, sc_addr_offset offset)
 {
   sc_assert(offset < SC_SEGMENT_ELEMENTS_COUNT && seg != null_ptr);
-  sc_segment_section * section = &seg->sections[offset % SC_CONCURRENCY_LEVEL];
+  sc_segment_section * section = sc_segment_get_section(seg, offset);
   sc_segment_section_lock(section);
   return &seg->elements[offset];
 }
@@ -237,7 +478,7 @@ sc_element * sc_segment_lock_element(sc_segment * seg, sc_addr_offset offset)
 sc_element * sc_segment_lock_element_try(sc_segment * seg, sc_addr_offset offset, sc_uint16 max_attempts)
 {
   sc_assert(offset < SC_SEGMENT_ELEMENTS_COUNT && seg != null_ptr);
-  sc_segment_section * section = &seg->sections[offset % SC_CONCURRENCY_LEVEL];
+  sc_segment_section * section = sc_segment_get_section(seg, offset);
 
   if (sc_segment_section_lock_try(section, max_attempts) == SC_TRUE)
     return &seg->elements[offset];
@@ -248,30 +489,168 @@ sc_element * sc_segment_lock_element_try(sc_segment * seg, sc_addr_offset offset
 void sc_segment_unlock_element(sc_segment * seg, sc_addr_offset offset)
 {
   sc_assert(offset < SC_SEGMENT_ELEMENTS_COUNT && seg != null_ptr);
-  sc_segment_section * section = &seg->sections[offset % SC_CONCURRENCY_LEVEL];
+  sc_segment_section * section = sc_segment_get_section(seg, offset);
   sc_segment_section_unlock(section);
 }
 
-void sc_segment_section_lock(sc_segment_section * section)
+sc_element * sc_segment_lock_element_shared(sc_segment * seg, sc_addr_offset offset)
 {
-  sc_pointer thread = sc_thread();
-lock:
+  sc_assert(offset < SC_SEGMENT_ELEMENTS_COUNT && seg != null_ptr);
+  sc_segment_section * section = sc_segment_get_section(seg, offset);
+  sc_segment_section_lock_shared(section);
+  return &seg->elements[offset];
+}
+
+void sc_segment_unlock_element_shared(sc_segment * seg, sc_addr_offset offset)
+{
+  sc_assert(offset < SC_SEGMENT_ELEMENTS_COUNT && seg != null_ptr);
+  sc_segment_section * section = sc_segment_get_section(seg, offset);
+  sc_segment_section_unlock_shared(section);
+}
+
+//! Locks internal state of section. It is held for a few instructions, so waiting thread never parks
+void _sc_segment_section_internal_lock(sc_segment_section * section)
 {
+  sc_spin_backoff backoff = SC_SPIN_BACKOFF_INIT;
   while (sc_atomic_int_compare_and_exchange(&section->internal_lock, 0, 1) == SC_FALSE)
-    ;
+  {
+    if (sc_spin_backoff_wait(&backoff) == SC_FALSE)
+      g_thread_yield();
+  }
+}
+
+void _sc_segment_section_internal_unlock(sc_segment_section * section)
+{
+  sc_atomic_int_set(&section->internal_lock, 0);
+}
+
+/*! Waits for release of section, that was busy, when wake_seq had specified value. Spins with backoff at first, and
+ * then parks thread, so descheduled owner of section can do its work.
+ */
+void _sc_segment_section_wait(sc_segment_section * section, sc_spin_backoff * backoff, sc_int32 wake_seq)
+{
+  if (sc_spin_backoff_wait(backoff) == SC_TRUE)
+    return;
+
+  sc_atomic_int_inc(&section->parked_count);
+  sc_spin_park(&section->wake_seq, wake_seq);
+  sc_atomic_int_add(&section->parked_count, -1);
 }
 
-  if (sc_atomic_pointer_get((void **)&section->thread_lock) != null_ptr &&
-      sc_atomic_pointer_get((void **)&section->thread_lock) != thread)
+//! Notifies threads, that wait for section, about its release. Must be called after section state was changed
+void _sc_segment_section_wake(sc_segment_section * section)
+{
+  sc_atomic_int_inc(&section->wake_seq);
+  if (sc_atomic_int_get(&section->parked_count) != 0)
+    sc_spin_unpark_all(&section->wake_seq);
+}
+
+/*! Tries to make current thread an exclusive owner of section. Owner is set even if section has readers, so new
+ * readers wait for it, and then caller waits for active readers to leave section.
+ */
+sc_bool _sc_segment_section_acquire_owner(sc_segment_section * section, sc_pointer thread)
+{
+  // only owner changes its own lock, so recursive lock doesn't need internal lock
+  if (sc_atomic_pointer_get((void **)&section->thread_lock) == thread)
   {
-    sc_atomic_int_set(&section->internal_lock, 0);
-    goto lock;
+    sc_atomic_int_inc(&section->lock_count);
+    return SC_TRUE;
   }
 
-  sc_atomic_pointer_set((void **)&section->thread_lock, thread);
-  sc_atomic_int_inc(&section->lock_count);
+  sc_bool acquired = SC_FALSE;
+  _sc_segment_section_internal_lock(section);
 
-  sc_atomic_int_set(&section->internal_lock, 0);
+  sc_pointer const owner = sc_atomic_pointer_get((void **)&section->thread_lock);
+  if (owner == null_ptr || owner == thread)
+  {
+    sc_atomic_pointer_set((void **)&section->thread_lock, thread);
+    sc_atomic_int_inc(&section->lock_count);
+    acquired = SC_TRUE;
+  }
+
+  _sc_segment_section_internal_unlock(section);
+  return acquired;
+}
+
+//! Returns shared lock of section by current thread, or null, if thread doesn't hold it
+sc_segment_shared_lock * _sc_segment_section_get_shared_lock(sc_segment_section * section)
+{
+  sc_segment_shared_locks * locks = g_private_get(&s_segment_shared_locks);
+  if (locks == null_ptr)
+    return null_ptr;
+
+  // thread usually holds a few shared locks, and the last ones are released at first
+  sc_uint32 i;
+  for (i = locks->count; i > 0; --i)
+  {
+    if (locks->locks[i - 1].section == section)
+      return &locks->locks[i - 1];
+  }
+
+  return null_ptr;
+}
+
+//! Remembers, that current thread locked section for reading
+void _sc_segment_section_track_shared(sc_segment_section * section)
+{
+  sc_segment_shared_locks * locks = g_private_get(&s_segment_shared_locks);
+  if (locks == null_ptr)
+  {
+    locks = sc_mem_new(sc_segment_shared_locks, 1);
+    g_private_set(&s_segment_shared_locks, locks);
+  }
+
+  if (locks->count == locks->capacity)
+  {
+    locks->capacity = locks->capacity == 0 ? SC_SEGMENT_SHARED_LOCKS_INITIAL_CAPACITY : locks->capacity * 2;
+    locks->locks = sc_mem_renew(locks->locks, sc_segment_shared_lock, locks->capacity);
+  }
+
+  sc_segment_shared_lock * lock = &locks->locks[locks->count++];
+  lock->section = section;
+  lock->depth = 1;
+}
+
+//! Forgets one shared lock of section by current thread
+void _sc_segment_section_untrack_shared(sc_segment_section * section)
+{
+  sc_segment_shared_lock * lock = _sc_segment_section_get_shared_lock(section);
+  if (lock == null_ptr || --lock->depth != 0)
+    return;
+
+  // the last lock is moved into place of released one
+  sc_segment_shared_locks * locks = g_private_get(&s_segment_shared_locks);
+  *lock = locks->locks[--locks->count];
+}
+
+void sc_segment_section_lock(sc_segment_section * section)
+{
+  sc_pointer thread = sc_thread();
+  sc_spin_backoff backoff = SC_SPIN_BACKOFF_INIT;
+
+  // owner waits for all readers, so it would wait for itself
+  sc_assert(_sc_segment_section_get_shared_lock(section) == null_ptr);
+
+  while (SC_TRUE)
+  {
+    // sequence is read before attempt, so release between attempt and parking isn't lost
+    sc_int32 const wake_seq = sc_atomic_int_get(&section->wake_seq);
+    if (_sc_segment_section_acquire_owner(section, thread) == SC_TRUE)
+      break;
+
+    _sc_segment_section_wait(section, &backoff, wake_seq);
+  }
+
+  // wait for readers, that entered section before owner was set
+  backoff.step = 0;
+  while (SC_TRUE)
+  {
+    sc_int32 const wake_seq = sc_atomic_int_get(&section->wake_seq);
+    if (sc_atomic_int_get(&section->readers_count) == 0)
+      break;
+
+    _sc_segment_section_wait(section, &backoff, wake_seq);
+  }
 }
 
 sc_bool sc_segment_section_lock_try(sc_segment_section * section, sc_uint16 max_attempts)
@@ -280,29 +659,33 @@ sc_bool sc_segment_section_lock_try(sc_segment_section * section, sc_uint16 max_
 
   sc_assert(section != null_ptr);
   sc_uint16 attempts = 0;
+  sc_spin_backoff backoff = SC_SPIN_BACKOFF_INIT;
 
-lock:
-{
-  while (sc_atomic_int_compare_and_exchange(&section->internal_lock, 0, 1) == SC_FALSE)
+  // section can't be upgraded from shared lock, because owner waits for all readers
+  if (_sc_segment_section_get_shared_lock(section) != null_ptr)
+    return SC_FALSE;
+
+  // caller has a fallback, so thread never parks here
+  while (_sc_segment_section_acquire_owner(section, thread) == SC_FALSE)
   {
-    if (max_attempts < attempts++)
+    if (++attempts >= max_attempts)
       return SC_FALSE;
+
+    if (sc_spin_backoff_wait(&backoff) == SC_FALSE)
+      g_thread_yield();
   }
-}
 
-  if (sc_atomic_pointer_get((void **)&section->thread_lock) != null_ptr &&
-      sc_atomic_pointer_get((void **)&section->thread_lock) != thread)
+  while (sc_atomic_int_get(&section->readers_count) != 0)
   {
-    sc_atomic_int_set(&section->internal_lock, 0);
     if (++attempts >= max_attempts)
+    {
+      sc_segment_section_unlock(section);
       return SC_FALSE;
-    goto lock;
-  }
-
-  sc_atomic_pointer_set((void **)&section->thread_lock, thread);
-  sc_atomic_int_inc(&section->lock_count);
+    }
 
-  sc_atomic_int_set(&section->internal_lock, 0);
+    if (sc_spin_backoff_wait(&backoff) == SC_FALSE)
+      g_thread_yield();
+  }
 
   return SC_TRUE;
 }
@@ -310,28 +693,117 @@ lock:
 void sc_segment_section_unlock(sc_segment_section * section)
 {
   sc_assert(section != null_ptr);
+  sc_assert(sc_atomic_pointer_get((void **)&section->thread_lock) == sc_thread());
 
-  while (sc_atomic_int_compare_and_exchange(&section->internal_lock, 0, 1) == SC_FALSE)
-    ;
+  // recursive unlock doesn't change owner
+  if (sc_atomic_int_get(&section->lock_count) > 1)
+  {
+    sc_atomic_int_add(&section->lock_count, -1);
+    return;
+  }
 
-  sc_assert(sc_atomic_pointer_get((void **)&section->thread_lock) == sc_thread());
+  sc_bool released = SC_FALSE;
+  _sc_segment_section_internal_lock(section);
 
   if (sc_atomic_int_dec_and_test(&section->lock_count) == SC_TRUE)
+  {
     sc_atomic_pointer_set((void **)&section->thread_lock, 0);
+    released = SC_TRUE;
+  }
 
-  sc_atomic_int_set(&section->internal_lock, 0);
+  _sc_segment_section_internal_unlock(section);
+
+  if (released == SC_TRUE)
+    _sc_segment_section_wake(section);
+}
+
+void sc_segment_section_lock_shared(sc_segment_section * section)
+{
+  sc_pointer thread = sc_thread();
+  sc_spin_backoff backoff = SC_SPIN_BACKOFF_INIT;
+
+  sc_assert(section != null_ptr);
+
+  // thread is already counted as reader, so waiting owner can't enter section before it; waiting for owner would
+  // deadlock
+  sc_segment_shared_lock * lock = _sc_segment_section_get_shared_lock(section);
+  if (lock != null_ptr)
+  {
+    sc_atomic_int_inc(&section->readers_count);
+    ++lock->depth;
+    return;
+  }
+
+  while (SC_TRUE)
+  {
+    sc_int32 const wake_seq = sc_atomic_int_get(&section->wake_seq);
+    _sc_segment_section_internal_lock(section);
+
+    sc_pointer const owner = sc_atomic_pointer_get((void **)&section->thread_lock);
+    if (owner == null_ptr)
+    {
+      sc_atomic_int_inc(&section->readers_count);
+      _sc_segment_section_internal_unlock(section);
+      _sc_segment_section_track_shared(section);
+      return;
+    }
+
+    if (owner == thread)
+    {
+      // thread already has exclusive access to section
+      sc_atomic_int_inc(&section->lock_count);
+      _sc_segment_section_internal_unlock(section);
+      return;
+    }
+
+    _sc_segment_section_internal_unlock(section);
+    _sc_segment_section_wait(section, &backoff, wake_seq);
+  }
+}
+
+void sc_segment_section_unlock_shared(sc_segment_section * section)
+{
+  sc_assert(section != null_ptr);
+
+  sc_bool released = SC_FALSE;
+  sc_bool is_reader = SC_FALSE;
+  _sc_segment_section_internal_lock(section);
+
+  if (sc_atomic_pointer_get((void **)&section->thread_lock) == sc_thread())
+  {
+    if (sc_atomic_int_dec_and_test(&section->lock_count) == SC_TRUE)
+    {
+      sc_atomic_pointer_set((void **)&section->thread_lock, 0);
+      released = SC_TRUE;
+    }
+  }
+  else
+  {
+    sc_assert(sc_atomic_int_get(&section->readers_count) > 0);
+    // the last reader lets waiting owner in
+    released = sc_atomic_int_dec_and_test(&section->readers_count);
+    is_reader = SC_TRUE;
+  }
+
+  _sc_segment_section_internal_unlock(section);
+
+  if (is_reader == SC_TRUE)
+    _sc_segment_section_untrack_shared(section);
+
+  if (released == SC_TRUE)
+    _sc_segment_section_wake(section);
 }
 
 void sc_segment_lock(sc_segment * seg)
 {
   sc_uint32 i;
-  for (i = 0; i < SC_CONCURRENCY_LEVEL; ++i)
+  for (i = 0; i < s_sections_count; ++i)
     sc_segment_section_lock(&seg->sections[i]);
 }
 
 void sc_segment_unlock(sc_segment * seg)
 {
   sc_uint32 i;
-  for (i = 0; i < SC_CONCURRENCY_LEVEL; ++i)
+  for (i = 0; i < s_sections_count; ++i)
     sc_segment_section_unlock(&seg->sections[i]);
 }
@@ -15,27 +15,59 @@
 
 #define SC_SEG_ELEMENTS_SIZE_BYTE (sizeof(sc_element) * SC_SEGMENT_ELEMENTS_COUNT)
 
+//! Number of bits in hashed slot position. Positions are permutation of all 16-bit offsets
+#define SC_SEGMENT_SLOTS_BITS 16
+//! Number of 64-bit words in bitmap of segment empty slots, that is indexed by slot positions
+#define SC_SEGMENT_MASK_SIZE ((1u << SC_SEGMENT_SLOTS_BITS) / 64)
+
 //! Structure to store segment locks
 typedef struct _sc_segment_section
 {
   volatile sc_pointer thread_lock;  // pointer to thread, that locked section
   sc_int empty_count;               // use 32-bit value for atomic operations
-  sc_int empty_offset;              // use 32-bit value for atomic operations
+  sc_int empty_word;                // index of the first segment empty_mask word, that can have empty slots of section
   sc_int internal_lock;             //
   sc_int lock_count;                // count of recursive locks
+  sc_int readers_count;             // count of threads, that hold shared lock
+  sc_int32 wake_seq;                // changed on each release of section, threads are parked on this value
+  sc_int32 parked_count;            // count of threads, that are parked on wake_seq
 } sc_segment_section;
 
 /*! Structure for segment storing
  */
 struct _sc_segment
 {
+#ifdef SC_SEGMENT_COLUMNS
+  // the first field, so 32-byte records are aligned with cache lines
+  sc_element_columns columns[SC_SEGMENT_ELEMENTS_COUNT];
+#endif
   sc_element_meta meta[SC_SEGMENT_ELEMENTS_COUNT];
   sc_element elements[SC_SEGMENT_ELEMENTS_COUNT];
-  sc_addr_seg num;  // number of this segment in memory
-  sc_segment_section sections[SC_CONCURRENCY_LEVEL];
-  sc_uint elements_count;  // number of sc-element in the segment
+  sc_addr_seg num;                                        // number of this segment in memory
+  sc_segment_section sections[SC_CONCURRENCY_LEVEL_MAX];  // only sc_segment_get_sections_count() of them are used
+  sc_uint elements_count;                                 // number of sc-element in the segment
+  // bit is set, when slot is empty; each section owns continuous range of bits (see sc_segment_get_section)
+  sc_uint64 empty_mask[SC_SEGMENT_MASK_SIZE];
+#ifdef SC_ARC_TYPE_INDEX
+  sc_element_typed_arcs typed_arcs[SC_SEGMENT_ELEMENTS_COUNT];  // changed under locks of sc-elements
+#endif
 };
 
+/*! Sets number of sections in segments. Must be called before any segment will be created.
+ * @param level Required number of sections. It is rounded up to the power of two and clamped to
+ * [1, SC_CONCURRENCY_LEVEL_MAX]
+ * @returns Number of sections, that will be used
+ */
+sc_uint32 sc_segment_set_concurrency_level(sc_uint32 level);
+
+//! Returns number of used sections in segments
+sc_uint32 sc_segment_get_sections_count();
+
+/*! Returns section, that contains sc-element with specified offset. Offsets are hashed, so neighbour sc-elements
+ * are in different sections, and each section has the same number of slots
+ */
+sc_segment_section * sc_segment_get_section(sc_segment * seg, sc_addr_offset offset);
+
 /*! Create new segment with specified size.
  * @param num Number of created instance in sc-memory
  */
@@ -47,6 +79,12 @@ void sc_segment_loaded(sc_segment * seg);
 
 void sc_segment_free(sc_segment * segment);
 
+/*! Returns memory, that is used by elements of empty segment, to OS. Segment stays valid and its pages are
+ * committed again on the next element allocation.
+ * @returns SC_TRUE, if memory was released; SC_FALSE, if segment isn't empty or some of its sections are locked.
+ */
+sc_bool sc_segment_release_memory(sc_segment * seg);
+
 //! Remove element from specified segment. @note sc-element need to be locked
 void sc_segment_erase_element(sc_segment * seg, sc_uint16 offset);
 
@@ -65,6 +103,14 @@ void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat);
 //! Returns pointer to sc-element metainfo
 sc_element_meta * sc_segment_get_meta(sc_segment * seg, sc_addr_offset offset);
 
+#ifdef SC_SEGMENT_COLUMNS
+//! Copies traversal fields of sc-element into segment columns. @note sc-element need to be locked
+void sc_segment_update_columns(sc_segment * seg, sc_addr_offset offset);
+
+//! Returns pointer to columns record of sc-element. @note sc-element need to be locked
+sc_element_columns const * sc_segment_get_columns(sc_segment * seg, sc_addr_offset offset);
+#endif
+
 // ---------------------- locks --------------------------
 /*! Function to lock any empty element
  * @param seg Pointer to segment where to lock empty element
@@ -74,6 +120,17 @@ sc_element_meta * sc_segment_get_meta(sc_segment * seg, sc_addr_offset offset);
  */
 sc_element * sc_segment_lock_empty_element(sc_memory_context const * ctx, sc_segment * seg, sc_addr_offset * offset);
 
+/*! Locks up to count empty elements, that are in the same section of segment, with one section lock
+ * @param offsets Pointer to array of count offsets to store locked elements
+ * @returns Number of locked empty elements. Section of them stays locked once, so it should be unlocked with
+ * sc_segment_section_unlock once too
+ */
+sc_uint32 sc_segment_lock_empty_elements(
+    sc_memory_context const * ctx,
+    sc_segment * seg,
+    sc_uint32 count,
+    sc_addr_offset * offsets);
+
 /*! Function to lock specified element in segment
  * @param seg Pointer to segment to lock element
  * @param offset Offset of element to lock
@@ -90,6 +147,16 @@ sc_element * sc_segment_lock_element_try(sc_segment * seg, sc_addr_offset offset
  */
 void sc_segment_unlock_element(sc_segment * seg, sc_addr_offset offset);
 
+/*! Locks sc-element for reading. Any number of threads can read sc-elements of the same section in parallel, while
+ * none of them holds exclusive lock. If current thread holds exclusive or shared lock of section, then it is locked
+ * recursively, even if another thread waits for exclusive lock.
+ * @note Thread, that holds shared lock, can't lock the same section exclusively: it's checked by assert, and
+ * sc_segment_section_lock_try returns SC_FALSE for it
+ */
+sc_element * sc_segment_lock_element_shared(sc_segment * seg, sc_addr_offset offset);
+
+void sc_segment_unlock_element_shared(sc_segment * seg, sc_addr_offset offset);
+
 //! Locks segment section. This function doesn't returns control, while part wouldn't be locked.
 void sc_segment_section_lock(sc_segment_section * section);
 /*! Try to lock segment section. If section already locked, then this function returns false; otherwise it locks section
@@ -101,6 +168,10 @@ sc_bool sc_segment_section_lock_try(sc_segment_section * section, sc_uint16 max_
 //! Unlocks specified segment part
 void sc_segment_section_unlock(sc_segment_section * section);
 
+//! Locks segment section for reading. Waits, while section is exclusively locked by another thread
+void sc_segment_section_lock_shared(sc_segment_section * section);
+void sc_segment_section_unlock_shared(sc_segment_section * section);
+
 // Lock whole segment
 void sc_segment_lock(sc_segment * seg);
 void sc_segment_unlock(sc_segment * seg);
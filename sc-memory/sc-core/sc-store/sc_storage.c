@@ -8,7 +8,10 @@
 
 #include "sc_defines.h"
 #include "sc_segment.h"
+#include "sc_epoch.h"
 #include "sc_element.h"
+#include "sc_arc_index.h"
+#include "sc_iterator3.h"
 #include "sc_event.h"
 #include "sc_stream_memory.h"
 
@@ -20,9 +23,12 @@
 #include "sc-base/sc_atomic.h"
 #include "sc-base/sc_assert_utils.h"
 #include "sc-base/sc_message.h"
+#include "sc-base/sc_spin.h"
+#include "sc-container/sc-hash-set/sc_hash_set.h"
 #include "sc-container/sc-string/sc_string.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 
 // segments array
 sc_segment ** segments = null_ptr;
@@ -34,32 +40,161 @@ const sc_uint16 s_max_storage_cache_attempts = 10;
 
 sc_bool is_initialized = SC_FALSE;
 
-sc_memory_context * segments_cache_lock_ctx = null_ptr;
 sc_int32 segments_cache_count = 0;
 sc_segment * segments_cache[SC_SEGMENT_CACHE_SIZE];  // cache of segments that have empty elements
+// maximum number of segments, that can be allocated in storage
+sc_uint32 segments_max_num = 0;
+// non-zero while some thread allocates new segment
+sc_int32 segments_creating = 0;
 
-GMutex s_mutex_free;
 GMutex s_mutex_save;
 
+//! Erased sc-element, which slot is recycled, when none of threads can read it without lock
+typedef struct _sc_storage_retired_element
+{
+  sc_addr addr;
+  sc_uint32 epoch;  // global epoch, when sc-element was erased
+} sc_storage_retired_element;
+
+// number of retired sc-elements, that aren't recycled, to warn about; it's doubled after each warning
+#define SC_STORAGE_RETIRED_WARNING_COUNT (1 << 20)
+
+// retired sc-elements are appended in order of their epochs; recycled ones are removed from the list head, so list is
+// compacted only when it's full
+GMutex s_retired_mutex;
+sc_storage_retired_element * s_retired_elements = null_ptr;
+sc_uint32 s_retired_head = 0;  // index of the oldest retired sc-element
+sc_int32 s_retired_count = 0;  // it's changed under s_retired_mutex and read atomically without it
+sc_uint32 s_retired_capacity = 0;
+sc_uint32 s_retired_warning_count = SC_STORAGE_RETIRED_WARNING_COUNT;
+
+// sc-elements, that are recycled now; buffer is reused by reclaims, that are serialized by its mutex
+GMutex s_reclaim_mutex;
+sc_addr * s_reclaimed_elements = null_ptr;
+sc_uint32 s_reclaimed_capacity = 0;
+
 #define CONCURRENCY_TO_CACHE_IDX(x) ((x) % SC_SEGMENT_CACHE_SIZE)
 
-void _sc_segment_cache_lock(const sc_memory_context * ctx)
+// synchronizes segment columns with changed sc-element, it need to be called while sc-element is locked
+#ifdef SC_SEGMENT_COLUMNS
+#  define STORAGE_UPDATE_COLUMNS(addr) \
+    sc_segment_update_columns(sc_atomic_pointer_get((void **)&segments[(addr).seg]), (addr).offset)
+#else
+#  define STORAGE_UPDATE_COLUMNS(addr)
+#endif
+
+#ifdef SC_ARC_TYPE_INDEX
+//! Returns index of sc-element arcs by their types, it need to be changed while sc-element is locked
+sc_element_typed_arcs * _sc_storage_get_typed_arcs(sc_addr addr)
 {
-  while (sc_atomic_pointer_compare_and_exchange((void **)&segments_cache_lock_ctx, null_ptr, (void *)ctx) == SC_FALSE)
-    ;
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  return &seg->typed_arcs[addr.offset];
 }
 
-void _sc_segment_cache_unlock(const sc_memory_context * ctx)
+//! Divides output or input arcs of loaded sc-element by types, so arcs of each type keep their order
+void _sc_storage_build_typed_arcs_lists(sc_addr addr, sc_element const * el, sc_bool is_output)
 {
-  sc_assert(sc_atomic_pointer_get((void **)&segments_cache_lock_ctx) == ctx);
-  sc_atomic_pointer_set((void **)&segments_cache_lock_ctx, null_ptr);
+  sc_element_typed_arcs * el_typed = _sc_storage_get_typed_arcs(addr);
+  sc_addr last[SC_ELEMENT_ARC_LISTS_COUNT];
+  sc_mem_set(last, 0, sizeof(last));
+
+  sc_addr arc = is_output ? el->first_out_arc : el->first_in_arc;
+  while (SC_ADDR_IS_NOT_EMPTY(arc))
+  {
+    sc_element const * arc_el = &segments[arc.seg]->elements[arc.offset];
+    sc_uint8 const list = sc_element_get_arc_list(arc_el->flags.type);
+    sc_element_typed_arcs * arc_typed = _sc_storage_get_typed_arcs(arc);
+
+    if (is_output)
+      ++el_typed->out_arcs_count[list];
+    else
+      ++el_typed->in_arcs_count[list];
+
+    if (is_output)
+    {
+      arc_typed->prev_out_arc = last[list];
+      if (SC_ADDR_IS_EMPTY(last[list]))
+        el_typed->first_out_arc[list] = arc;
+      else
+        _sc_storage_get_typed_arcs(last[list])->next_out_arc = arc;
+    }
+    else
+    {
+      arc_typed->prev_in_arc = last[list];
+      if (SC_ADDR_IS_EMPTY(last[list]))
+        el_typed->first_in_arc[list] = arc;
+      else
+        _sc_storage_get_typed_arcs(last[list])->next_in_arc = arc;
+    }
+
+    last[list] = arc;
+    arc = is_output ? arc_el->arc.next_out_arc : arc_el->arc.next_in_arc;
+  }
+}
+
+//! Builds index of arcs by types for all loaded sc-elements
+void _sc_storage_build_typed_arcs()
+{
+  sc_uint32 seg_num, offset;
+  for (seg_num = 0; seg_num < segments_num; ++seg_num)
+  {
+    sc_segment * seg = segments[seg_num];
+    if (seg == null_ptr)
+      continue;
+
+    for (offset = 0; offset < SC_SEGMENT_ELEMENTS_COUNT; ++offset)
+    {
+      sc_element const * el = &seg->elements[offset];
+      if (el->flags.type == 0)
+        continue;
+
+      sc_addr addr;
+      addr.seg = seg_num;
+      addr.offset = offset;
+      _sc_storage_build_typed_arcs_lists(addr, el, SC_TRUE);
+      _sc_storage_build_typed_arcs_lists(addr, el, SC_FALSE);
+    }
+  }
+}
+#endif
+
+#ifdef SC_ARC_HASH_INDEX
+//! Appends all loaded sc-arcs into hash index
+void _sc_storage_build_arc_index()
+{
+  sc_uint32 seg_num, offset;
+  for (seg_num = 0; seg_num < segments_num; ++seg_num)
+  {
+    sc_segment * seg = segments[seg_num];
+    if (seg == null_ptr)
+      continue;
+
+    for (offset = 0; offset < SC_SEGMENT_ELEMENTS_COUNT; ++offset)
+    {
+      sc_element const * el = &seg->elements[offset];
+      if ((el->flags.type & sc_type_arc_mask) == 0 || (el->flags.type & sc_flag_request_deletion))
+        continue;
+
+      sc_addr addr;
+      addr.seg = seg_num;
+      addr.offset = offset;
+      sc_arc_index_append(el->arc.begin, el->arc.end, addr);
+    }
+  }
+}
+#endif
+
+//! Returns cache index preferred by current thread, so threads tend to fill their own segments
+sc_uint32 _sc_segment_cache_thread_idx()
+{
+  sc_uint64 const thread = (sc_uint64)GPOINTER_TO_SIZE(sc_thread());
+  return CONCURRENCY_TO_CACHE_IDX((sc_uint32)((thread >> 4) * 2654435761u >> 16));
 }
 
 void _sc_segment_cache_append(sc_segment * seg)
 {
-  sc_uint cidx = GPOINTER_TO_UINT(sc_thread());
   sc_int32 i;
-  sc_uint32 idx = CONCURRENCY_TO_CACHE_IDX(cidx);
+  sc_uint32 idx = _sc_segment_cache_thread_idx();
   for (i = 0; i < SC_SEGMENT_CACHE_SIZE; ++i)
   {
     if (sc_atomic_pointer_compare_and_exchange(
@@ -71,9 +206,10 @@ void _sc_segment_cache_append(sc_segment * seg)
   }
 }
 
-void _sc_segment_cache_remove(const sc_memory_context * ctx, sc_segment * seg)
+void _sc_segment_cache_remove(sc_segment * seg)
 {
-  sc_int32 i, idx = CONCURRENCY_TO_CACHE_IDX(ctx->id);
+  sc_int32 i;
+  sc_uint32 idx = _sc_segment_cache_thread_idx();
   for (i = 0; i < SC_SEGMENT_CACHE_SIZE; ++i)
   {
     if (sc_atomic_pointer_compare_and_exchange(
@@ -90,6 +226,7 @@ void _sc_segment_cache_clear()
   sc_int32 i;
   for (i = 0; i < SC_SEGMENT_CACHE_SIZE; ++i)
     sc_atomic_pointer_set((void **)&segments_cache[i], null_ptr);
+  sc_atomic_int_set(&segments_cache_count, 0);
 }
 
 void _sc_segment_cache_update()
@@ -99,49 +236,89 @@ void _sc_segment_cache_update()
   for (i = 0; i < sc_atomic_int_get(&segments_num); ++i)
   {
     sc_segment * s = sc_atomic_pointer_get((void **)&(segments[i]));
-    // need to check pointer, because segments_num increments earlier, then segments appends into array
-    if (s != null_ptr)
-    {
-      if (sc_segment_has_empty_slot(s))
-        _sc_segment_cache_append(s);
-    }
+    if (sc_segment_has_empty_slot(s))
+      _sc_segment_cache_append(s);
 
-    if (sc_atomic_int_get(&segments_cache_count) == SC_SEGMENT_CACHE_SIZE)
+    if (sc_atomic_int_get(&segments_cache_count) >= SC_SEGMENT_CACHE_SIZE)
       break;
   }
 }
 
-sc_segment * _sc_segment_cache_get(const sc_memory_context * ctx)
+sc_segment * _sc_segment_cache_find()
 {
-  _sc_segment_cache_lock(ctx);
+  if (sc_atomic_int_get(&segments_cache_count) <= 0)
+    return null_ptr;
 
-  g_mutex_lock(&s_mutex_save);
+  sc_int32 i;
+  sc_uint32 idx = _sc_segment_cache_thread_idx();
+  for (i = 0; i < SC_SEGMENT_CACHE_SIZE; ++i)
+  {
+    sc_segment * seg = sc_atomic_pointer_get((void **)&segments_cache[(idx + i) % SC_SEGMENT_CACHE_SIZE]);
+    if (seg != null_ptr)
+      return seg;
+  }
+
+  return null_ptr;
+}
 
+/*! Returns segment, that has empty slots. Cached segments are taken without any locks. Only one thread at a time
+ * refills cache and allocates new segment, other threads wait for it and don't block sc_storage_save, because new
+ * segment becomes visible (segments_num incremented) only after it was fully constructed.
+ * @returns Null pointer, if there are no segments with empty slots and segments limit reached.
+ */
+sc_segment * _sc_segment_cache_get()
+{
   sc_segment * seg = null_ptr;
-  if (sc_atomic_int_get(&segments_cache_count) > 0)
+  sc_spin_backoff backoff = SC_SPIN_BACKOFF_INIT;
+  while (SC_TRUE)
   {
-    sc_int32 i, idx = CONCURRENCY_TO_CACHE_IDX(ctx->id);
-    for (i = 0; i < SC_SEGMENT_CACHE_SIZE; ++i)
-    {
-      seg = sc_atomic_pointer_get((void **)&segments_cache[(idx + i) % SC_SEGMENT_CACHE_SIZE]);
-      if (seg != null_ptr)
-        goto result;
-    }
+    seg = _sc_segment_cache_find();
+    if (seg != null_ptr)
+      return seg;
+
+    if (sc_atomic_int_compare_and_exchange(&segments_creating, 0, 1) == SC_TRUE)
+      break;
+
+    // creation of segment takes a while, so park until creator finishes
+    if (sc_spin_backoff_wait(&backoff) == SC_FALSE)
+      sc_spin_park(&segments_creating, 1);
   }
 
+  // segment could be added into cache, while we were trying to become creator
+  seg = _sc_segment_cache_find();
+  if (seg != null_ptr)
+    goto result;
+
   // try to update cache
   _sc_segment_cache_update();
+  seg = _sc_segment_cache_find();
+  if (seg != null_ptr)
+    goto result;
 
   // if element still not added, then create new segment and append element into it
-  sc_int32 seg_num = sc_atomic_int_add(&segments_num, 1);
+  sc_uint32 const seg_num = sc_atomic_int_get(&segments_num);
+  if (seg_num >= segments_max_num)
+  {
+    sc_critical("Max number of sc-memory segments (%u) reached", segments_max_num);
+    goto result;
+  }
+
   seg = sc_segment_new(seg_num);
-  segments[seg_num] = seg;
+  if (seg == null_ptr)
+  {
+    sc_critical("Can't allocate memory for sc-memory segment %u", seg_num);
+    goto result;
+  }
+
+  sc_atomic_pointer_set((void **)&segments[seg_num], seg);
+  // publish segment after it was stored in segments array
+  sc_atomic_int_inc(&segments_num);
   _sc_segment_cache_append(seg);
 
 result:
 {
-  _sc_segment_cache_unlock(ctx);
-  g_mutex_unlock(&s_mutex_save);
+  sc_atomic_int_set(&segments_creating, 0);
+  sc_spin_unpark_all(&segments_creating);
 }
 
   return seg;
@@ -155,13 +332,25 @@ sc_bool sc_storage_initialize(sc_memory_params const * params)
   if (result == SC_FALSE)
     return SC_FALSE;
 
-  segments = sc_mem_new(sc_segment *, params->max_loaded_segments);
-  memset(&*segments_cache, 0, sizeof(sc_segment *) * SC_SEGMENT_CACHE_SIZE);
+  segments_max_num = sc_min(params->max_loaded_segments, SC_ADDR_SEG_MAX);
+  segments = sc_mem_new(sc_segment *, segments_max_num);
+  sc_segment_set_concurrency_level(params->concurrency_level);
+  _sc_segment_cache_clear();
+
+#ifdef SC_ARC_HASH_INDEX
+  sc_arc_index_initialize();
+#endif
 
   if (params->clear == SC_FALSE)
   {
     if (sc_fs_memory_load(segments, &segments_num) != SC_TRUE)
       return SC_FALSE;
+#ifdef SC_ARC_TYPE_INDEX
+    _sc_storage_build_typed_arcs();
+#endif
+#ifdef SC_ARC_HASH_INDEX
+    _sc_storage_build_arc_index();
+#endif
   }
   else
   {
@@ -174,6 +363,9 @@ sc_bool sc_storage_initialize(sc_memory_params const * params)
 
 sc_bool sc_storage_shutdown(sc_bool save_state)
 {
+  // there are no readers, so all erased sc-elements are recycled before save
+  sc_storage_reclaim_elements(SC_TRUE);
+
   if (save_state == SC_TRUE)
   {
     if (sc_fs_memory_save(segments, segments_num) == SC_FALSE)
@@ -195,6 +387,27 @@ sc_bool sc_storage_shutdown(sc_bool save_state)
   segments = null_ptr;
   segments_num = 0;
 
+#ifdef SC_ARC_HASH_INDEX
+  sc_arc_index_shutdown();
+#endif
+
+  sc_iterator3_parallel_walk_shutdown();
+
+  g_mutex_lock(&s_reclaim_mutex);
+  sc_mem_free(s_reclaimed_elements);
+  s_reclaimed_elements = null_ptr;
+  s_reclaimed_capacity = 0;
+  g_mutex_unlock(&s_reclaim_mutex);
+
+  g_mutex_lock(&s_retired_mutex);
+  sc_mem_free(s_retired_elements);
+  s_retired_elements = null_ptr;
+  s_retired_head = 0;
+  s_retired_capacity = 0;
+  s_retired_warning_count = SC_STORAGE_RETIRED_WARNING_COUNT;
+  sc_atomic_int_set(&s_retired_count, 0);
+  g_mutex_unlock(&s_retired_mutex);
+
   _sc_segment_cache_clear();
   is_initialized = SC_FALSE;
   return SC_TRUE;
@@ -205,88 +418,154 @@ sc_bool sc_storage_is_initialized()
   return is_initialized;
 }
 
-sc_bool sc_storage_is_element(const sc_memory_context * ctx, sc_addr addr)
+//! Reads header of sc-element without lock. Returns SC_RESULT_ERROR_INVALID_STATE, if sc-element doesn't exist
+sc_result _sc_storage_read_element_header(sc_addr addr, sc_element_columns * columns)
 {
-  sc_element * el = null_ptr;
-  sc_bool res = SC_TRUE;
+  if (addr.seg >= SC_ADDR_SEG_MAX || addr.offset >= SC_SEGMENT_ELEMENTS_COUNT)
+    return SC_RESULT_ERROR;
 
-  if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
-    return SC_FALSE;
+  sc_segment * segment = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  if (segment == null_ptr)
+    return SC_RESULT_ERROR;
 
-  if (el->flags.type == 0 || (el->flags.type & sc_flag_request_deletion))
-    res = SC_FALSE;
+  // memory of segments isn't unmapped, so header is copied without epoch; if sc-element is erased or its slot is
+  // recycled concurrently, then its type is changed, and copy is discarded
+  sc_element * el = &segment->elements[addr.offset];
+  sc_storage_get_element_columns(addr, el, columns);
 
-  sc_storage_element_unlock(addr);
+  if (columns->type == 0 || (columns->type & sc_flag_request_deletion))
+    return SC_RESULT_ERROR_INVALID_STATE;
 
-  return res;
+  sc_atomic_fence();
+  if (((sc_element volatile *)el)->flags.type != columns->type)
+    return SC_RESULT_ERROR_INVALID_STATE;
+
+  return SC_RESULT_OK;
 }
 
-sc_uint32 sc_storage_get_element_output_arcs_count(const sc_memory_context * ctx, sc_addr addr)
+sc_bool sc_storage_is_element(const sc_memory_context * ctx, sc_addr addr)
 {
-  sc_element * el = null_ptr;
-  sc_uint32 count = 0;
+  sc_element_columns columns;
+  return _sc_storage_read_element_header(addr, &columns) == SC_RESULT_OK;
+}
 
-  if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
-    return count;
+//! Reads number of output or input arcs of sc-element, that can have specified type, without lock
+sc_uint32 _sc_storage_read_element_arcs_count(sc_addr addr, sc_type arc_type, sc_bool is_output)
+{
+  if (addr.seg >= SC_ADDR_SEG_MAX || addr.offset >= SC_SEGMENT_ELEMENTS_COUNT)
+    return 0;
 
-  count = sc_atomic_int_get(&el->output_arcs_count);
+  sc_segment * segment = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  if (segment == null_ptr)
+    return 0;
 
-  sc_storage_element_unlock(addr);
+  // memory of segments isn't unmapped, so counters are read without epoch; if sc-element is erased concurrently, then
+  // its counters can be read after its slot is recycled, that is acceptable for estimation
+  sc_element * el = &segment->elements[addr.offset];
+  sc_type const type = el->flags.type;
+  if (type == 0 || (type & sc_flag_request_deletion))
+    return 0;
+
+  sc_uint32 count = sc_atomic_int_get(is_output ? &el->output_arcs_count : &el->input_arcs_count);
+
+#ifdef SC_ARC_TYPE_INDEX
+  // arcs of one kind are in their own list or in list of mixed arcs
+  sc_uint8 const list = sc_element_get_arc_list(arc_type);
+  if ((arc_type & sc_type_arc_mask) != 0 && list != SC_ELEMENT_ARC_LIST_MIXED)
+  {
+    sc_element_typed_arcs * typed = &segment->typed_arcs[addr.offset];
+    sc_uint32 * counts = is_output ? typed->out_arcs_count : typed->in_arcs_count;
+    count = sc_atomic_int_get(&counts[list]) + sc_atomic_int_get(&counts[SC_ELEMENT_ARC_LIST_MIXED]);
+  }
+#else
+  (void)arc_type;
+#endif
 
   return count;
 }
 
-sc_uint32 sc_storage_get_element_input_arcs_count(const sc_memory_context * ctx, sc_addr addr)
+sc_uint32 sc_storage_get_element_output_arcs_count(const sc_memory_context * ctx, sc_addr addr)
 {
-  sc_element * el = null_ptr;
-  sc_uint32 count = 0;
-
-  if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
-    return count;
+  return _sc_storage_read_element_arcs_count(addr, 0, SC_TRUE);
+}
 
-  count = sc_atomic_int_get(&el->input_arcs_count);
+sc_uint32 sc_storage_get_element_input_arcs_count(const sc_memory_context * ctx, sc_addr addr)
+{
+  return _sc_storage_read_element_arcs_count(addr, 0, SC_FALSE);
+}
 
-  sc_storage_element_unlock(addr);
+sc_uint32 sc_storage_get_element_output_arcs_count_by_type(
+    const sc_memory_context * ctx,
+    sc_addr addr,
+    sc_type arc_type)
+{
+  return _sc_storage_read_element_arcs_count(addr, arc_type, SC_TRUE);
+}
 
-  return count;
+sc_uint32 sc_storage_get_element_input_arcs_count_by_type(
+    const sc_memory_context * ctx,
+    sc_addr addr,
+    sc_type arc_type)
+{
+  return _sc_storage_read_element_arcs_count(addr, arc_type, SC_FALSE);
 }
 
-sc_element * sc_storage_append_el_into_segments(const sc_memory_context * ctx, sc_addr * addr)
+sc_uint32 sc_storage_append_els_into_segments(const sc_memory_context * ctx, sc_uint32 count, sc_addr * addrs)
 {
-  sc_segment * seg = (sc_segment *)0x1;
+  sc_addr_offset offsets[SC_STORAGE_APPEND_BATCH_SIZE];
 
-  sc_assert(addr != null_ptr);
-  SC_ADDR_MAKE_EMPTY(*addr);
+  sc_assert(addrs != null_ptr);
+  count = sc_min(count, SC_STORAGE_APPEND_BATCH_SIZE);
 
-  /// @todo store segment with empty slots
   // try to find segment with empty slots
-  while (seg != null_ptr)
+  while (count > 0)
   {
-    sc_segment * seg = _sc_segment_cache_get(ctx);
+    sc_segment * seg = _sc_segment_cache_get();
 
     if (seg == null_ptr)
       break;
 
-    sc_element * el = sc_segment_lock_empty_element(ctx, seg, &addr->offset);
-    if (el != null_ptr)
+    sc_uint32 const locked = sc_segment_lock_empty_elements(ctx, seg, count, offsets);
+    if (locked == 0)
     {
-      addr->seg = seg->num;
+      _sc_segment_cache_remove(seg);
+      continue;
+    }
+
+    sc_uint32 i;
+    for (i = 0; i < locked; ++i)
+    {
+      addrs[i].seg = seg->num;
+      addrs[i].offset = offsets[i];
+
+      sc_element * el = &seg->elements[offsets[i]];
       el->flags.access_levels = sc_access_lvl_min(ctx->access_levels, el->flags.access_levels);
       el->input_arcs_count = 0;
       el->output_arcs_count = 0;
 
-      sc_element_meta * meta = sc_segment_get_meta(seg, addr->offset);
+      sc_element_meta * meta = sc_segment_get_meta(seg, offsets[i]);
       sc_assert(meta != null_ptr);
       meta->ref_count = 1;
-      return el;
-    }
-    else
-    {
-      _sc_segment_cache_remove(ctx, seg);
     }
+
+    return locked;
   }
 
-  return null_ptr;
+  return 0;
+}
+
+sc_element * sc_storage_append_el_into_segments(const sc_memory_context * ctx, sc_addr * addr)
+{
+  sc_assert(addr != null_ptr);
+
+  if (sc_storage_append_els_into_segments(ctx, 1, addr) == 0)
+  {
+    SC_ADDR_MAKE_EMPTY(*addr);
+    return null_ptr;
+  }
+
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addr->seg]);
+  return &seg->elements[addr->offset];
 }
 
 sc_addr sc_storage_element_new_access(const sc_memory_context * ctx, sc_type type, sc_access_levels access_levels)
@@ -299,6 +578,7 @@ sc_addr sc_storage_element_new_access(const sc_memory_context * ctx, sc_type typ
   {
     res->flags.type = type;
     res->flags.access_levels = access_levels;
+    STORAGE_UPDATE_COLUMNS(addr);
     STORAGE_CHECK_CALL(sc_storage_element_unlock(addr));
   }
   else
@@ -309,316 +589,472 @@ sc_addr sc_storage_element_new_access(const sc_memory_context * ctx, sc_type typ
   return addr;
 }
 
-sc_result sc_storage_element_free(sc_memory_context * ctx, sc_addr addr)
+struct _sc_storage_free_arena
+{
+  sc_addr * elements;  // sc-elements to remove in order of their discovery
+  sc_uint32 elements_count;
+  sc_uint32 elements_capacity;
+  sc_hash_set removed;   // local sc-addrs of sc-elements to remove
+  sc_uint32 * sections;  // keys of locked sections in order of locking
+  sc_uint32 sections_count;
+  sc_uint32 sections_capacity;
+  sc_uint32 max_section;          // the greatest key of locked sections
+  sc_uint32 failed_section;       // key of section, that wasn't locked in the last attempt
+  sc_hash_set locked;             // keys of locked sections
+  sc_event_emit_params * events;  // events of deletion, that are emitted together after erasing
+  sc_uint32 events_count;
+  sc_uint32 events_capacity;
+};
+
+sc_storage_free_arena * _sc_storage_free_arena_new()
 {
-  GHashTable * remove_table = null_ptr;
-  GHashTable * lock_table = null_ptr;
-  GSList * remove_list = null_ptr;
-  sc_result result = SC_RESULT_OK;
+  sc_storage_free_arena * arena = sc_mem_new(sc_storage_free_arena, 1);
+  sc_hash_set_init(&arena->removed);
+  sc_hash_set_init(&arena->locked);
+  return arena;
+}
 
-  g_mutex_lock(&s_mutex_free);
+/*! Takes arena of context, so deletions in other threads with the same context don't use it at the same time. If it's
+ * taken by another deletion, then temporary arena is created
+ */
+sc_storage_free_arena * _sc_storage_free_arena_acquire(sc_memory_context * ctx)
+{
+  sc_storage_free_arena * arena = sc_atomic_pointer_get((void **)&ctx->free_arena);
+  if (arena != null_ptr && sc_atomic_pointer_compare_and_exchange((void **)&ctx->free_arena, arena, null_ptr))
+    return arena;
 
-  // the first we need to collect and lock all elements
-  sc_element * el = null_ptr;
-  if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
+  return _sc_storage_free_arena_new();
+}
+
+//! Returns arena into context. If context already has another arena, then this one is destroyed
+void _sc_storage_free_arena_release(sc_memory_context * ctx, sc_storage_free_arena * arena)
+{
+  if (sc_atomic_pointer_compare_and_exchange((void **)&ctx->free_arena, null_ptr, arena) == SC_FALSE)
+    sc_storage_free_arena_destroy(arena);
+}
+
+void sc_storage_free_arena_destroy(sc_storage_free_arena * arena)
+{
+  if (arena == null_ptr)
+    return;
+
+  sc_mem_free(arena->elements);
+  sc_mem_free(arena->sections);
+  sc_mem_free(arena->events);
+  sc_hash_set_destroy(&arena->removed);
+  sc_hash_set_destroy(&arena->locked);
+  sc_mem_free(arena);
+}
+
+//! Returns non-zero key of section, that contains sc-element. Keys are ordered by segments and then by sections
+sc_uint32 _sc_storage_section_key(sc_addr addr)
+{
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  sc_uint32 const idx = (sc_uint32)(sc_segment_get_section(seg, addr.offset) - seg->sections);
+  return addr.seg * SC_CONCURRENCY_LEVEL_MAX + idx + 1;
+}
+
+sc_segment_section * _sc_storage_section_by_key(sc_uint32 key)
+{
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[(key - 1) / SC_CONCURRENCY_LEVEL_MAX]);
+  return &seg->sections[(key - 1) % SC_CONCURRENCY_LEVEL_MAX];
+}
+
+//! Returns sc-element, that is locked by deletion
+sc_element * _sc_storage_free_get_element(sc_addr addr)
+{
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  return &seg->elements[addr.offset];
+}
+
+void _sc_storage_free_push_section(sc_storage_free_arena * arena, sc_uint32 key)
+{
+  if (arena->sections_count == arena->sections_capacity)
   {
-    g_mutex_unlock(&s_mutex_free);
-    return SC_RESULT_ERROR;
+    arena->sections_capacity = arena->sections_capacity == 0 ? 64 : arena->sections_capacity * 2;
+    arena->sections = sc_mem_renew(arena->sections, sc_uint32, arena->sections_capacity);
   }
 
-  sc_assert(el != null_ptr);
-  if (el->flags.type == 0 || el->flags.type & sc_flag_request_deletion)
+  arena->sections[arena->sections_count++] = key;
+}
+
+void _sc_storage_free_push_element(sc_storage_free_arena * arena, sc_addr addr)
+{
+  if (arena->elements_count == arena->elements_capacity)
   {
-    g_mutex_unlock(&s_mutex_free);
-    sc_storage_element_unlock(addr);
-    return SC_RESULT_ERROR;
+    arena->elements_capacity = arena->elements_capacity == 0 ? 256 : arena->elements_capacity * 2;
+    arena->elements = sc_mem_renew(arena->elements, sc_addr, arena->elements_capacity);
   }
 
-  remove_table = g_hash_table_new(g_direct_hash, g_direct_equal);
-  lock_table = g_hash_table_new(g_direct_hash, g_direct_equal);
-  g_hash_table_insert(remove_table, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr)), el);
-  g_hash_table_insert(lock_table, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr)), el);
+  arena->elements[arena->elements_count++] = addr;
+}
+
+void _sc_storage_free_push_event(
+    sc_storage_free_arena * arena,
+    sc_addr el,
+    sc_access_levels el_access,
+    sc_event_type type,
+    sc_addr edge,
+    sc_addr other_el)
+{
+  // bulk deletion of sc-elements without subscriptions doesn't collect events
+  if (sc_storage_element_has_events(el, type) == SC_FALSE)
+    return;
 
-  remove_list = g_slist_append(remove_list, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr)));
-  while (remove_list != null_ptr)
+  if (arena->events_count == arena->events_capacity)
   {
-    // get sc-addr for removing
-    sc_uint32 addr_int = GPOINTER_TO_UINT(remove_list->data);
-    sc_addr _addr;
-    _addr.seg = SC_ADDR_LOCAL_SEG_FROM_INT(addr_int);
-    _addr.offset = SC_ADDR_LOCAL_OFFSET_FROM_INT(addr_int);
+    arena->events_capacity = arena->events_capacity == 0 ? 256 : arena->events_capacity * 2;
+    arena->events = sc_mem_renew(arena->events, sc_event_emit_params, arena->events_capacity);
+  }
 
-    gpointer p_addr = GUINT_TO_POINTER(addr_int);
+  sc_event_emit_params * params = &arena->events[arena->events_count++];
+  params->el = el;
+  params->el_access = el_access;
+  params->type = type;
+  params->edge = edge;
+  params->other_el = other_el;
+}
 
-    // go to next sc-addr in list
-    remove_list = g_slist_delete_link(remove_list, remove_list);
+/*! Locks section of sc-element for deletion. Thread waits only for sections, that are greater than all locked ones,
+ * so deleting threads can't wait for each other in a cycle. Other sections are tried to be locked.
+ * @returns SC_FALSE, if section wasn't locked and all locks should be released
+ */
+sc_bool _sc_storage_free_lock(sc_storage_free_arena * arena, sc_addr addr)
+{
+  sc_uint32 const key = _sc_storage_section_key(addr);
+  if (sc_hash_set_contains(&arena->locked, key) == SC_TRUE)
+    return SC_TRUE;
 
-    if (!sc_access_lvl_check_write(ctx->access_levels, el->flags.access_levels))
-    {
-      result = SC_RESULT_ERROR_NO_WRITE_RIGHTS;
-      goto unlock;
-    }
+  sc_segment_section * section = _sc_storage_section_by_key(key);
+  if (key > arena->max_section)
+  {
+    sc_segment_section_lock(section);
+    arena->max_section = key;
+  }
+  else if (sc_segment_section_lock_try(section, s_max_storage_lock_attempts) == SC_FALSE)
+  {
+    arena->failed_section = key;
+    return SC_FALSE;
+  }
 
-    el = g_hash_table_lookup(lock_table, p_addr);
-    if (el == null_ptr)
-    {
-      STORAGE_CHECK_CALL(sc_storage_element_lock(_addr, &el));
+  sc_hash_set_insert(&arena->locked, key);
+  _sc_storage_free_push_section(arena, key);
+  return SC_TRUE;
+}
 
-      sc_assert(el->flags.type != 0);
-      g_hash_table_insert(remove_table, p_addr, el);
-      g_hash_table_insert(lock_table, p_addr, el);
-    }
+//! Locks section of neighbour sc-arc, if it exists
+sc_bool _sc_storage_free_lock_neighbour(sc_storage_free_arena * arena, sc_addr addr)
+{
+  return SC_ADDR_IS_EMPTY(addr) || _sc_storage_free_lock(arena, addr);
+}
 
-    if (el->flags.type & sc_type_arc_mask)
-    {
-      // lock begin and end elements of arc
-      sc_element * el2 = null_ptr;
-      p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(el->arc.begin));
-      if ((el2 = g_hash_table_lookup(lock_table, p_addr)) == null_ptr)
-      {
-        STORAGE_CHECK_CALL(sc_storage_element_lock(el->arc.begin, &el2));
-        g_hash_table_insert(lock_table, p_addr, el2);
-      }
+void _sc_storage_free_unlock(sc_storage_free_arena * arena)
+{
+  sc_uint32 i;
+  for (i = 0; i < arena->sections_count; ++i)
+    sc_segment_section_unlock(_sc_storage_section_by_key(arena->sections[i]));
 
-      p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(el->arc.end));
-      if ((el2 = g_hash_table_lookup(lock_table, p_addr)) == null_ptr)
-      {
-        el2 = null_ptr;
-        STORAGE_CHECK_CALL(sc_storage_element_lock(el->arc.end, &el2));
-        g_hash_table_insert(lock_table, p_addr, el2);
-      }
+  sc_hash_set_clear(&arena->locked);
+  arena->max_section = 0;
+}
 
-      // lock next/prev arcs in out/in lists
-      if (SC_ADDR_IS_NOT_EMPTY(el->arc.prev_out_arc))
-      {
-        p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(el->arc.prev_out_arc));
-        if (g_hash_table_lookup(lock_table, p_addr) == null_ptr)
-        {
-          el2 = null_ptr;
-          STORAGE_CHECK_CALL(sc_storage_element_lock(el->arc.prev_out_arc, &el2));
-          sc_assert(el2 != null_ptr);
-          g_hash_table_insert(lock_table, p_addr, el2);
-        }
-      }
+int _sc_storage_section_key_compare(void const * a, void const * b)
+{
+  sc_uint32 const ka = *(sc_uint32 const *)a;
+  sc_uint32 const kb = *(sc_uint32 const *)b;
+  return (ka > kb) - (ka < kb);
+}
 
-      if (SC_ADDR_IS_NOT_EMPTY(el->arc.prev_in_arc))
-      {
-        p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(el->arc.prev_in_arc));
-        if (g_hash_table_lookup(lock_table, p_addr) == null_ptr)
-        {
-          el2 = null_ptr;
-          STORAGE_CHECK_CALL(sc_storage_element_lock(el->arc.prev_in_arc, &el2));
-          sc_assert(el2 != null_ptr);
-          g_hash_table_insert(lock_table, p_addr, el2);
-        }
-      }
+//! Locks sections, that were needed in the previous attempt, in order of their keys
+void _sc_storage_free_relock(sc_storage_free_arena * arena)
+{
+  if (arena->failed_section != 0)
+  {
+    _sc_storage_free_push_section(arena, arena->failed_section);
+    arena->failed_section = 0;
+  }
 
-      if (SC_ADDR_IS_NOT_EMPTY(el->arc.next_out_arc))
-      {
-        p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(el->arc.next_out_arc));
-        if (g_hash_table_lookup(lock_table, p_addr) == null_ptr)
-        {
-          el2 = null_ptr;
-          STORAGE_CHECK_CALL(sc_storage_element_lock(el->arc.next_out_arc, &el2));
-          sc_assert(el2 != null_ptr);
-          g_hash_table_insert(lock_table, p_addr, el2);
-        }
-      }
+  qsort(arena->sections, arena->sections_count, sizeof(sc_uint32), _sc_storage_section_key_compare);
 
-      if (SC_ADDR_IS_NOT_EMPTY(el->arc.next_in_arc))
-      {
-        p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(el->arc.next_in_arc));
-        if (g_hash_table_lookup(lock_table, p_addr) == null_ptr)
-        {
-          el2 = null_ptr;
-          STORAGE_CHECK_CALL(sc_storage_element_lock(el->arc.next_in_arc, &el2));
-          sc_assert(el2 != null_ptr);
-          g_hash_table_insert(lock_table, p_addr, el2);
-        }
-      }
-    }
+  sc_uint32 i;
+  for (i = 0; i < arena->sections_count; ++i)
+  {
+    sc_segment_section_lock(_sc_storage_section_by_key(arena->sections[i]));
+    sc_hash_set_insert(&arena->locked, arena->sections[i]);
+    arena->max_section = arena->sections[i];
+  }
+}
 
-    // Iterate all connectors for deleted element and append them into remove_list
-    _addr = el->first_out_arc;
-    while (SC_ADDR_IS_NOT_EMPTY(_addr))
-    {
-      gpointer p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_addr));
-      sc_element * el2 = g_hash_table_lookup(remove_table, p_addr);
+//! Appends connectors of list, that starts with specified sc-arc, into remove list
+sc_bool _sc_storage_free_collect_arcs(sc_storage_free_arena * arena, sc_addr arc, sc_bool is_output)
+{
+  while (SC_ADDR_IS_NOT_EMPTY(arc))
+  {
+    if (_sc_storage_free_lock(arena, arc) == SC_FALSE)
+      return SC_FALSE;
 
-      if (el2 == null_ptr)
-      {
-        el2 = g_hash_table_lookup(lock_table, p_addr);
-        if (el2 == null_ptr)
-        {
-          sc_storage_element_lock(_addr, &el2);
-          g_hash_table_insert(lock_table, p_addr, el2);
-        }
+    if (sc_hash_set_insert(&arena->removed, SC_ADDR_LOCAL_TO_INT(arc)) == SC_TRUE)
+      _sc_storage_free_push_element(arena, arc);
 
-        sc_assert(el2 != null_ptr);
-        g_hash_table_insert(remove_table, p_addr, el2);
+    sc_element * arc_el = _sc_storage_free_get_element(arc);
+    arc = is_output ? arc_el->arc.next_out_arc : arc_el->arc.next_in_arc;
+  }
 
-        remove_list = g_slist_append(remove_list, p_addr);
-      }
+  return SC_TRUE;
+}
 
-      _addr = el2->arc.next_out_arc;
-    }
+/*! Collects sc-elements and all their connectors into remove list and locks them with their neighbours. Sc-elements,
+ * that don't exist, are skipped.
+ * @returns SC_RESULT_NO, if some section wasn't locked, and all locks should be released before the next attempt;
+ * SC_RESULT_ERROR, if there are no sc-elements to remove
+ */
+sc_result _sc_storage_free_collect(
+    sc_memory_context const * ctx,
+    sc_storage_free_arena * arena,
+    sc_addr const * addrs,
+    sc_uint32 count)
+{
+  _sc_storage_free_relock(arena);
 
-    _addr = el->first_in_arc;
-    while (SC_ADDR_IS_NOT_EMPTY(_addr))
-    {
-      gpointer p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_addr));
-      sc_element * el2 = g_hash_table_lookup(remove_table, p_addr);
+  arena->elements_count = 0;
+  sc_hash_set_clear(&arena->removed);
 
-      if (el2 == null_ptr)
-      {
-        el2 = g_hash_table_lookup(lock_table, p_addr);
-        if (el2 == null_ptr)
-        {
-          sc_storage_element_lock(_addr, &el2);
-          g_hash_table_insert(lock_table, p_addr, el2);
-        }
+  sc_element * el;
+  sc_uint32 i;
+  for (i = 0; i < count; ++i)
+  {
+    sc_addr const addr = addrs[i];
+    if (addr.seg >= SC_ADDR_SEG_MAX || sc_atomic_pointer_get((void **)&segments[addr.seg]) == null_ptr)
+      continue;
 
-        sc_assert(el2 != null_ptr);
-        g_hash_table_insert(remove_table, p_addr, el2);
+    if (_sc_storage_free_lock(arena, addr) == SC_FALSE)
+      return SC_RESULT_NO;
 
-        remove_list = g_slist_append(remove_list, p_addr);
-      }
+    el = _sc_storage_free_get_element(addr);
+    if (el->flags.type == 0 || el->flags.type & sc_flag_request_deletion)
+      continue;
+
+    if (sc_hash_set_insert(&arena->removed, SC_ADDR_LOCAL_TO_INT(addr)) == SC_TRUE)
+      _sc_storage_free_push_element(arena, addr);
+  }
+
+  if (arena->elements_count == 0)
+    return SC_RESULT_ERROR;
+
+  // remove list grows, while its elements are processed
+  for (i = 0; i < arena->elements_count; ++i)
+  {
+    sc_addr const el_addr = arena->elements[i];
+    el = _sc_storage_free_get_element(el_addr);
+
+    if (!sc_access_lvl_check_write(ctx->access_levels, el->flags.access_levels))
+      return SC_RESULT_ERROR_NO_WRITE_RIGHTS;
 
-      _addr = el2->arc.next_in_arc;
+    if (el->flags.type & sc_type_arc_mask)
+    {
+      // lock begin and end elements of arc, and next/prev arcs in out/in lists
+      if (_sc_storage_free_lock(arena, el->arc.begin) == SC_FALSE ||
+          _sc_storage_free_lock(arena, el->arc.end) == SC_FALSE)
+        return SC_RESULT_NO;
+
+      if (_sc_storage_free_lock_neighbour(arena, el->arc.prev_out_arc) == SC_FALSE ||
+          _sc_storage_free_lock_neighbour(arena, el->arc.prev_in_arc) == SC_FALSE ||
+          _sc_storage_free_lock_neighbour(arena, el->arc.next_out_arc) == SC_FALSE ||
+          _sc_storage_free_lock_neighbour(arena, el->arc.next_in_arc) == SC_FALSE)
+        return SC_RESULT_NO;
+
+#ifdef SC_ARC_TYPE_INDEX
+      // lock neighbours in lists of arcs, that correspond to arc type
+      sc_element_typed_arcs const * typed = _sc_storage_get_typed_arcs(el_addr);
+      if (_sc_storage_free_lock_neighbour(arena, typed->prev_out_arc) == SC_FALSE ||
+          _sc_storage_free_lock_neighbour(arena, typed->prev_in_arc) == SC_FALSE ||
+          _sc_storage_free_lock_neighbour(arena, typed->next_out_arc) == SC_FALSE ||
+          _sc_storage_free_lock_neighbour(arena, typed->next_in_arc) == SC_FALSE)
+        return SC_RESULT_NO;
+#endif
     }
 
-    // clean temp addr
-    SC_ADDR_MAKE_EMPTY(_addr);
+    // iterate all connectors for deleted element and append them into remove list
+    if (_sc_storage_free_collect_arcs(arena, el->first_out_arc, SC_TRUE) == SC_FALSE ||
+        _sc_storage_free_collect_arcs(arena, el->first_in_arc, SC_FALSE) == SC_FALSE)
+      return SC_RESULT_NO;
   }
 
-  // now we need to erase all elements
-  GHashTableIter iter;
-  g_hash_table_iter_init(&iter, remove_table);
-  gpointer key, value;
-  while (g_hash_table_iter_next(&iter, &key, &value) == TRUE)
-  {
-    el = value;
-    sc_uint32 uint_addr = GPOINTER_TO_UINT(key);
-    gpointer p_addr;
-    addr.offset = SC_ADDR_LOCAL_OFFSET_FROM_INT(uint_addr);
-    addr.seg = SC_ADDR_LOCAL_SEG_FROM_INT(uint_addr);
-    sc_access_levels el_access = el->flags.access_levels;
+  return SC_RESULT_OK;
+}
 
-    if (el->flags.type & sc_flag_request_deletion)
+#ifdef SC_ARC_TYPE_INDEX
+//! Removes locked sc-arc from lists of arcs, that correspond to its type, of its begin and end sc-elements
+void _sc_storage_typed_arc_unlink(sc_addr addr, sc_element const * el)
+{
+  sc_uint8 const list = sc_element_get_arc_list(el->flags.type);
+  sc_element_typed_arcs const * arc_typed = _sc_storage_get_typed_arcs(addr);
+
+  // next arcs of erased arc stay valid for iterators, that reached it
+  if (SC_ADDR_IS_NOT_EMPTY(arc_typed->prev_out_arc))
+    _sc_storage_get_typed_arcs(arc_typed->prev_out_arc)->next_out_arc = arc_typed->next_out_arc;
+  else
+    _sc_storage_get_typed_arcs(el->arc.begin)->first_out_arc[list] = arc_typed->next_out_arc;
+
+  if (SC_ADDR_IS_NOT_EMPTY(arc_typed->next_out_arc))
+    _sc_storage_get_typed_arcs(arc_typed->next_out_arc)->prev_out_arc = arc_typed->prev_out_arc;
+
+  if (SC_ADDR_IS_NOT_EMPTY(arc_typed->prev_in_arc))
+    _sc_storage_get_typed_arcs(arc_typed->prev_in_arc)->next_in_arc = arc_typed->next_in_arc;
+  else
+    _sc_storage_get_typed_arcs(el->arc.end)->first_in_arc[list] = arc_typed->next_in_arc;
+
+  if (SC_ADDR_IS_NOT_EMPTY(arc_typed->next_in_arc))
+    _sc_storage_get_typed_arcs(arc_typed->next_in_arc)->prev_in_arc = arc_typed->prev_in_arc;
+
+  sc_atomic_int_add(&_sc_storage_get_typed_arcs(el->arc.begin)->out_arcs_count[list], -1);
+  sc_atomic_int_add(&_sc_storage_get_typed_arcs(el->arc.end)->in_arcs_count[list], -1);
+}
+#endif
+
+/*! Erases locked sc-elements of remove list. At first all connectors are unlinked from their lists, while all
+ * sc-elements are still valid, then sc-elements are released. Events of deletion are emitted together at the end.
+ */
+void _sc_storage_free_erase(sc_memory_context * ctx, sc_storage_free_arena * arena)
+{
+  arena->events_count = 0;
+
+  sc_uint32 i;
+  for (i = 0; i < arena->elements_count; ++i)
+  {
+    sc_addr const addr = arena->elements[i];
+    sc_element * el = _sc_storage_free_get_element(addr);
+
+    if ((el->flags.type & sc_type_arc_mask) == 0 || el->flags.type & sc_flag_request_deletion)
       continue;
 
-    if (el->flags.type & sc_type_link)
+    // output arcs
+    sc_addr prev_arc = el->arc.prev_out_arc;
+    sc_addr next_arc = el->arc.next_out_arc;
+
+    if (SC_ADDR_IS_NOT_EMPTY(prev_arc))
     {
-      sc_fs_memory_unlink_string(SC_ADDR_LOCAL_TO_INT(addr));
+      _sc_storage_free_get_element(prev_arc)->arc.next_out_arc = next_arc;
+      STORAGE_UPDATE_COLUMNS(prev_arc);
     }
-    else if (el->flags.type & sc_type_arc_mask)
+
+    if (SC_ADDR_IS_NOT_EMPTY(next_arc))
+      _sc_storage_free_get_element(next_arc)->arc.prev_out_arc = prev_arc;
+
+    sc_element * b_el = _sc_storage_free_get_element(el->arc.begin);
+    if (SC_ADDR_IS_EQUAL(addr, b_el->first_out_arc))
     {
-      // output arcs
-      sc_addr prev_arc = el->arc.prev_out_arc;
-      sc_addr next_arc = el->arc.next_out_arc;
+      b_el->first_out_arc = next_arc;
+      STORAGE_UPDATE_COLUMNS(el->arc.begin);
+    }
 
-      if (SC_ADDR_IS_NOT_EMPTY(prev_arc))
-      {
-        p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(prev_arc));
-        sc_element * prev_el_arc = g_hash_table_lookup(lock_table, p_addr);
-        sc_assert(prev_el_arc != null_ptr);
-        prev_el_arc->arc.next_out_arc = next_arc;
-      }
+    sc_atomic_int_add(&b_el->output_arcs_count, -1);
+    _sc_storage_free_push_event(
+        arena, el->arc.begin, b_el->flags.access_levels, SC_EVENT_REMOVE_OUTPUT_ARC, addr, el->arc.end);
 
-      if (SC_ADDR_IS_NOT_EMPTY(next_arc))
-      {
-        p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(next_arc));
-        sc_element * next_el_arc = g_hash_table_lookup(lock_table, p_addr);
-        sc_assert(next_el_arc != null_ptr);
-        next_el_arc->arc.prev_out_arc = prev_arc;
-      }
+    // input arcs
+    prev_arc = el->arc.prev_in_arc;
+    next_arc = el->arc.next_in_arc;
 
-      sc_element * b_el = g_hash_table_lookup(lock_table, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(el->arc.begin)));
-      sc_bool need_unlock = SC_FALSE;
-      if (b_el == null_ptr)
-      {
-        STORAGE_CHECK_CALL(sc_storage_element_lock(el->arc.begin, &b_el));
-        need_unlock = SC_TRUE;
-      }
-      if (SC_ADDR_IS_EQUAL(addr, b_el->first_out_arc))
-        b_el->first_out_arc = next_arc;
+    if (SC_ADDR_IS_NOT_EMPTY(prev_arc))
+    {
+      _sc_storage_free_get_element(prev_arc)->arc.next_in_arc = next_arc;
+      STORAGE_UPDATE_COLUMNS(prev_arc);
+    }
 
-      sc_atomic_int_add(&b_el->output_arcs_count, -1);
-      sc_event_emit(ctx, el->arc.begin, b_el->flags.access_levels, SC_EVENT_REMOVE_OUTPUT_ARC, addr, el->arc.end);
+    if (SC_ADDR_IS_NOT_EMPTY(next_arc))
+      _sc_storage_free_get_element(next_arc)->arc.prev_in_arc = prev_arc;
 
-      if (need_unlock)
-        sc_storage_element_unlock(el->arc.begin);
+    sc_element * e_el = _sc_storage_free_get_element(el->arc.end);
+    if (SC_ADDR_IS_EQUAL(addr, e_el->first_in_arc))
+    {
+      e_el->first_in_arc = next_arc;
+      STORAGE_UPDATE_COLUMNS(el->arc.end);
+    }
 
-      // input arcs
-      prev_arc = el->arc.prev_in_arc;
-      next_arc = el->arc.next_in_arc;
+    sc_atomic_int_add(&e_el->input_arcs_count, -1);
+    _sc_storage_free_push_event(
+        arena, el->arc.end, e_el->flags.access_levels, SC_EVENT_REMOVE_INPUT_ARC, addr, el->arc.begin);
 
-      if (SC_ADDR_IS_NOT_EMPTY(prev_arc))
-      {
-        p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(prev_arc));
-        sc_element * prev_el_arc = g_hash_table_lookup(lock_table, p_addr);
-        sc_assert(prev_el_arc != null_ptr);
-        prev_el_arc->arc.next_in_arc = next_arc;
-      }
+#ifdef SC_ARC_TYPE_INDEX
+    _sc_storage_typed_arc_unlink(addr, el);
+#endif
+#ifdef SC_ARC_HASH_INDEX
+    sc_arc_index_remove(el->arc.begin, el->arc.end, addr);
+#endif
+  }
 
-      if (SC_ADDR_IS_NOT_EMPTY(next_arc))
-      {
-        p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(next_arc));
-        sc_element * next_el_arc = g_hash_table_lookup(lock_table, p_addr);
-        sc_assert(next_el_arc != null_ptr);
-        next_el_arc->arc.prev_in_arc = prev_arc;
-      }
+  sc_addr empty;
+  SC_ADDR_MAKE_EMPTY(empty);
 
-      need_unlock = SC_FALSE;
-      sc_element * e_el = g_hash_table_lookup(lock_table, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(el->arc.end)));
-      if (e_el == null_ptr)
-      {
-        STORAGE_CHECK_CALL(sc_storage_element_lock(el->arc.end, &e_el));
-        need_unlock = SC_TRUE;
-      }
-      if (SC_ADDR_IS_EQUAL(addr, e_el->first_in_arc))
-        e_el->first_in_arc = next_arc;
+  // remove list is compacted to sc-elements, that are erased now
+  sc_uint32 erased_count = 0;
+  for (i = 0; i < arena->elements_count; ++i)
+  {
+    sc_addr const addr = arena->elements[i];
+    sc_element * el = _sc_storage_free_get_element(addr);
 
-      sc_atomic_int_add(&e_el->input_arcs_count, -1);
-      sc_event_emit(ctx, el->arc.end, e_el->flags.access_levels, SC_EVENT_REMOVE_INPUT_ARC, addr, el->arc.begin);
+    if (el->flags.type & sc_flag_request_deletion)
+      continue;
 
-      if (need_unlock)
-        sc_storage_element_unlock(el->arc.end);
-    }
+    if (el->flags.type & sc_type_link)
+      sc_fs_memory_unlink_string(SC_ADDR_LOCAL_TO_INT(addr));
+
+    _sc_storage_free_push_event(arena, addr, el->flags.access_levels, SC_EVENT_REMOVE_ELEMENT, empty, empty);
 
     el->flags.type |= sc_flag_request_deletion;
+    STORAGE_UPDATE_COLUMNS(addr);
     sc_storage_element_unref(addr);
 
-    sc_addr empty;
-    SC_ADDR_MAKE_EMPTY(empty);
-    sc_event_emit(ctx, addr, el_access, SC_EVENT_REMOVE_ELEMENT, empty, empty);
-
-    // remove registered events before deletion
-    sc_event_notify_element_deleted(addr);
+    arena->elements[erased_count++] = addr;
   }
 
-unlock:
+  sc_event_emit_batch(ctx, arena->events, arena->events_count);
 
-  // now unlock elements
-  g_hash_table_iter_init(&iter, lock_table);
-  while (g_hash_table_iter_next(&iter, &key, &value) == SC_TRUE)
-  {
-    sc_uint32 uint_addr = GPOINTER_TO_UINT(key);
-    addr.offset = SC_ADDR_LOCAL_OFFSET_FROM_INT(uint_addr);
-    addr.seg = SC_ADDR_LOCAL_SEG_FROM_INT(uint_addr);
+  // remove registered events before deletion
+  sc_event_notify_elements_deleted(arena->elements, erased_count);
+}
 
-    sc_storage_element_unlock(addr);
-  }
+sc_result _sc_storage_elements_free(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count)
+{
+  // buffers are kept in context, so the next deletion doesn't allocate them again
+  sc_storage_free_arena * arena = _sc_storage_free_arena_acquire(ctx);
+  arena->sections_count = 0;
+  arena->failed_section = 0;
 
-  g_mutex_unlock(&s_mutex_free);
+  // the first we need to collect and lock all elements
+  sc_result result;
+  while ((result = _sc_storage_free_collect(ctx, arena, addrs, count)) == SC_RESULT_NO)
+    _sc_storage_free_unlock(arena);
+
+  // now we need to erase all elements
+  if (result == SC_RESULT_OK)
+    _sc_storage_free_erase(ctx, arena);
 
-  g_slist_free(remove_list);
-  g_hash_table_destroy(remove_table);
-  g_hash_table_destroy(lock_table);
+  _sc_storage_free_unlock(arena);
+  _sc_storage_free_arena_release(ctx, arena);
+
+  // erased sc-elements are recycled without locks held, as recycling locks them again
+  sc_storage_reclaim_elements(SC_FALSE);
 
   return result;
 }
 
+sc_result sc_storage_element_free(sc_memory_context * ctx, sc_addr addr)
+{
+  return _sc_storage_elements_free(ctx, &addr, 1);
+}
+
+sc_result sc_storage_elements_free_batch(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count)
+{
+  if (count == 0)
+    return SC_RESULT_OK;
+
+  sc_result const result = _sc_storage_elements_free(ctx, addrs, count);
+  // sc-elements, that don't exist, aren't error for batch
+  return result == SC_RESULT_ERROR ? SC_RESULT_OK : result;
+}
+
 sc_addr sc_storage_node_new(const sc_memory_context * ctx, sc_type type)
 {
   return sc_storage_node_new_ext(ctx, type, ctx->access_levels);
@@ -634,6 +1070,7 @@ sc_addr sc_storage_node_new_ext(const sc_memory_context * ctx, sc_type type, sc_
   {
     locked_el->flags.type = sc_flags_remove(sc_type_node | type);
     locked_el->flags.access_levels = access_levels;
+    STORAGE_UPDATE_COLUMNS(addr);
     STORAGE_CHECK_CALL(sc_storage_element_unlock(addr));
   }
   else
@@ -644,6 +1081,42 @@ sc_addr sc_storage_node_new_ext(const sc_memory_context * ctx, sc_type type, sc_
   return addr;
 }
 
+sc_uint32 sc_storage_nodes_new_batch(
+    const sc_memory_context * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * result)
+{
+  sc_uint32 created = 0;
+  sc_uint32 i;
+  while (created < count)
+  {
+    sc_uint32 const appended = sc_storage_append_els_into_segments(ctx, count - created, result + created);
+    if (appended == 0)
+      break;
+
+    sc_segment * seg = sc_atomic_pointer_get((void **)&segments[result[created].seg]);
+    for (i = created; i < created + appended; ++i)
+    {
+      sc_assert(!(sc_type_arc_mask & types[i]));
+
+      sc_element * el = &seg->elements[result[i].offset];
+      el->flags.type = sc_flags_remove(sc_type_node | types[i]);
+      el->flags.access_levels = ctx->access_levels;
+      STORAGE_UPDATE_COLUMNS(result[i]);
+    }
+
+    // all appended sc-elements are in the same section
+    STORAGE_CHECK_CALL(sc_storage_element_unlock(result[created]));
+    created += appended;
+  }
+
+  for (i = created; i < count; ++i)
+    SC_ADDR_MAKE_EMPTY(result[i]);
+
+  return created;
+}
+
 sc_addr sc_storage_link_new(const sc_memory_context * ctx, sc_bool is_const)
 {
   return sc_storage_link_new_ext(ctx, ctx->access_levels, is_const);
@@ -658,6 +1131,7 @@ sc_addr sc_storage_link_new_ext(const sc_memory_context * ctx, sc_access_levels
   {
     locked_el->flags.type = sc_type_link | (is_const ? sc_type_const : sc_type_var);
     locked_el->flags.access_levels = access_levels;
+    STORAGE_UPDATE_COLUMNS(addr);
     STORAGE_CHECK_CALL(sc_storage_element_unlock(addr));
   }
   else
@@ -673,160 +1147,316 @@ sc_addr sc_storage_arc_new(sc_memory_context * ctx, sc_type type, sc_addr beg, s
   return sc_storage_arc_new_ext(ctx, type, beg, end, ctx->access_levels);
 }
 
-sc_addr sc_storage_arc_new_ext(
+//! Links locked appended sc-arc with locked begin sc-element and its end sc-element
+sc_result _sc_storage_arc_link_locked(
     sc_memory_context * ctx,
+    sc_addr addr,
+    sc_element * arc_el,
     sc_type type,
     sc_addr beg,
+    sc_element * beg_el,
     sc_addr end,
     sc_access_levels access_levels)
-{
-  sc_addr addr;
-
-  sc_assert(!(sc_type_node & type));
-
-  sc_result r;
-  SC_ADDR_MAKE_EMPTY(addr);
-
-  if (SC_ADDR_IS_EMPTY(beg) || SC_ADDR_IS_EMPTY(end))
-    return addr;
+{
+  sc_result r = SC_RESULT_ERROR;
+  sc_element *end_el = null_ptr, *f_out_arc = null_ptr, *f_in_arc = null_ptr;
+#ifdef SC_ARC_TYPE_INDEX
+  sc_element *f_typed_out_arc = null_ptr, *f_typed_in_arc = null_ptr;
+  sc_addr first_typed_out_arc, first_typed_in_arc;
+#endif
+
+  // try to lock end element
+  if (SC_ADDR_IS_EMPTY(end) ||
+      sc_storage_element_lock_try(end, s_max_storage_lock_attempts, &end_el) != SC_RESULT_OK)
+    return SC_RESULT_ERROR_INVALID_STATE;
+
+  if (end_el == null_ptr)
+    return SC_RESULT_ERROR;
 
-  while (SC_ADDR_IS_EMPTY(addr))
+  if (sc_element_is_valid(end_el) == SC_FALSE)
   {
-    sc_element *beg_el = null_ptr, *end_el = null_ptr;
-    sc_element *f_out_arc = null_ptr, *f_in_arc = null_ptr;
-    sc_element * tmp_el = null_ptr;
-    sc_bool should_break = SC_FALSE;
+    r = SC_RESULT_ERROR_INVALID_STATE;
+    goto unlock;
+  }
+
+  sc_access_levels const beg_access = beg_el->flags.access_levels;
+  sc_access_levels const end_access = end_el->flags.access_levels;
 
-    // try to lock begin and end elements
-    r = sc_storage_element_lock_try(beg, s_max_storage_lock_attempts, &beg_el);
-    if (beg_el == null_ptr)
+  // lock arcs to change output/input list
+  sc_addr const first_out_arc = beg_el->first_out_arc;
+  if (SC_ADDR_IS_NOT_EMPTY(first_out_arc))
+  {
+    sc_storage_element_lock_try(first_out_arc, s_max_storage_lock_attempts, &f_out_arc);
+    if (f_out_arc == null_ptr)
       goto unlock;
+  }
 
-    if (sc_element_is_valid(beg_el) == SC_FALSE)
-    {
-      should_break = SC_TRUE;
-      r = SC_RESULT_ERROR_INVALID_STATE;
+  sc_addr const first_in_arc = end_el->first_in_arc;
+  if (SC_ADDR_IS_NOT_EMPTY(first_in_arc))
+  {
+    sc_storage_element_lock_try(first_in_arc, s_max_storage_lock_attempts, &f_in_arc);
+    if (f_in_arc == null_ptr)
       goto unlock;
-    }
+  }
 
-    sc_access_levels beg_access = beg_el->flags.access_levels;
+  sc_type const arc_type = sc_flags_remove((type & sc_type_arc_mask) ? type : (sc_type_arc_common | type));
 
-    r = sc_storage_element_lock_try(end, s_max_storage_lock_attempts, &end_el);
-    if (end_el == null_ptr)
+#ifdef SC_ARC_TYPE_INDEX
+  // lock the first arcs of lists, that correspond to arc type
+  sc_uint8 const list = sc_element_get_arc_list(arc_type);
+  sc_element_typed_arcs * beg_typed = _sc_storage_get_typed_arcs(beg);
+  sc_element_typed_arcs * end_typed = _sc_storage_get_typed_arcs(end);
+
+  first_typed_out_arc = beg_typed->first_out_arc[list];
+  if (SC_ADDR_IS_NOT_EMPTY(first_typed_out_arc))
+  {
+    sc_storage_element_lock_try(first_typed_out_arc, s_max_storage_lock_attempts, &f_typed_out_arc);
+    if (f_typed_out_arc == null_ptr)
       goto unlock;
+  }
 
-    if (sc_element_is_valid(end_el) == SC_FALSE)
-    {
-      should_break = SC_TRUE;
-      r = SC_RESULT_ERROR_INVALID_STATE;
+  first_typed_in_arc = end_typed->first_in_arc[list];
+  if (SC_ADDR_IS_NOT_EMPTY(first_typed_in_arc))
+  {
+    sc_storage_element_lock_try(first_typed_in_arc, s_max_storage_lock_attempts, &f_typed_in_arc);
+    if (f_typed_in_arc == null_ptr)
       goto unlock;
-    }
+  }
+#endif
+
+  sc_atomic_int_inc(&beg_el->output_arcs_count);
+  sc_atomic_int_inc(&end_el->input_arcs_count);
+#ifdef SC_ARC_TYPE_INDEX
+  sc_atomic_int_inc(&beg_typed->out_arcs_count[list]);
+  sc_atomic_int_inc(&end_typed->in_arcs_count[list]);
+#endif
+
+  arc_el->flags.type = arc_type;
+  arc_el->arc.begin = beg;
+  arc_el->arc.end = end;
+  arc_el->flags.access_levels = access_levels;
+
+  // emit events, if sc-elements have subscriptions for them
+  if (sc_storage_element_has_events(beg, SC_EVENT_ADD_OUTPUT_ARC))
+    sc_event_emit(ctx, beg, beg_access, SC_EVENT_ADD_OUTPUT_ARC, addr, end);
+  if (sc_storage_element_has_events(end, SC_EVENT_ADD_INPUT_ARC))
+    sc_event_emit(ctx, end, end_access, SC_EVENT_ADD_INPUT_ARC, addr, beg);
 
-    sc_access_levels end_access = end_el->flags.access_levels;
+  // check values
+  sc_assert(beg_el->flags.type != 0 && end_el->flags.type != 0);
 
-    // lock arcs to change output/input list
-    sc_addr first_out_arc = beg_el->first_out_arc;
-    if (SC_ADDR_IS_NOT_EMPTY(first_out_arc))
-    {
-      r = sc_storage_element_lock_try(first_out_arc, s_max_storage_lock_attempts, &f_out_arc);
-      if (f_out_arc == null_ptr)
-        goto unlock;
-    }
+  // set next output arc for our created arc
+  arc_el->arc.next_out_arc = first_out_arc;
+  arc_el->arc.next_in_arc = first_in_arc;
 
-    sc_addr first_in_arc = end_el->first_in_arc;
-    if (SC_ADDR_IS_NOT_EMPTY(first_in_arc))
-    {
-      r = sc_storage_element_lock_try(first_in_arc, s_max_storage_lock_attempts, &f_in_arc);
-      if (f_in_arc == null_ptr)
-        goto unlock;
-    }
+  sc_assert(SC_ADDR_IS_NOT_EQUAL(addr, first_out_arc) && SC_ADDR_IS_NOT_EQUAL(addr, first_in_arc));
+  if (f_out_arc)
+    f_out_arc->arc.prev_out_arc = addr;
 
-    // get new element
-    tmp_el = sc_storage_append_el_into_segments(ctx, &addr);
-    sc_atomic_int_inc(&beg_el->output_arcs_count);
-    sc_atomic_int_inc(&end_el->input_arcs_count);
+  if (f_in_arc)
+    f_in_arc->arc.prev_in_arc = addr;
 
-    tmp_el->flags.type = sc_flags_remove((type & sc_type_arc_mask) ? type : (sc_type_arc_common | type));
-    tmp_el->arc.begin = beg;
-    tmp_el->arc.end = end;
-    tmp_el->flags.access_levels = access_levels;
+#ifdef SC_ARC_TYPE_INDEX
+  sc_element_typed_arcs * arc_typed = _sc_storage_get_typed_arcs(addr);
+  arc_typed->next_out_arc = first_typed_out_arc;
+  arc_typed->next_in_arc = first_typed_in_arc;
+  SC_ADDR_MAKE_EMPTY(arc_typed->prev_out_arc);
+  SC_ADDR_MAKE_EMPTY(arc_typed->prev_in_arc);
 
-    sc_assert(tmp_el != null_ptr);
-    sc_assert(SC_ADDR_IS_NOT_EQUAL(addr, first_in_arc));
+  if (f_typed_out_arc)
+    _sc_storage_get_typed_arcs(first_typed_out_arc)->prev_out_arc = addr;
 
-    // emit events
-    sc_event_emit(ctx, beg, beg_access, SC_EVENT_ADD_OUTPUT_ARC, addr, end);
-    sc_event_emit(ctx, end, end_access, SC_EVENT_ADD_INPUT_ARC, addr, beg);
+  if (f_typed_in_arc)
+    _sc_storage_get_typed_arcs(first_typed_in_arc)->prev_in_arc = addr;
+#endif
+
+  // arc is read by iterators without lock, so it's completed before it will be published in lists
+  STORAGE_UPDATE_COLUMNS(addr);
+  sc_atomic_fence();
 
-    // check values
-    sc_assert(beg_el != null_ptr && end_el != null_ptr);
-    sc_assert(beg_el->flags.type != 0 && end_el->flags.type != 0);
+  // set our arc as first output/input at begin/end elements
+  beg_el->first_out_arc = addr;
+  end_el->first_in_arc = addr;
+#ifdef SC_ARC_TYPE_INDEX
+  beg_typed->first_out_arc[list] = addr;
+  end_typed->first_in_arc[list] = addr;
+#endif
+#ifdef SC_ARC_HASH_INDEX
+  sc_arc_index_append(beg, end, addr);
+#endif
 
-    // set next output arc for our created arc
-    tmp_el->arc.next_out_arc = first_out_arc;
-    tmp_el->arc.next_in_arc = first_in_arc;
+  STORAGE_UPDATE_COLUMNS(beg);
+  STORAGE_UPDATE_COLUMNS(end);
 
-    sc_assert(SC_ADDR_IS_NOT_EQUAL(addr, first_out_arc) && SC_ADDR_IS_NOT_EQUAL(addr, first_in_arc));
-    if (f_out_arc)
-      f_out_arc->arc.prev_out_arc = addr;
+  r = SC_RESULT_OK;
 
-    if (f_in_arc)
-      f_in_arc->arc.prev_in_arc = addr;
+unlock:
+{
+  if (f_out_arc != null_ptr)
+    sc_storage_element_unlock(first_out_arc);
+  if (f_in_arc != null_ptr)
+    sc_storage_element_unlock(first_in_arc);
+#ifdef SC_ARC_TYPE_INDEX
+  if (f_typed_out_arc != null_ptr)
+    sc_storage_element_unlock(first_typed_out_arc);
+  if (f_typed_in_arc != null_ptr)
+    sc_storage_element_unlock(first_typed_in_arc);
+#endif
+  sc_storage_element_unlock(end);
+}
 
-    // set our arc as first output/input at begin/end elements
-    beg_el->first_out_arc = addr;
-    end_el->first_in_arc = addr;
+  return r;
+}
 
-  unlock:
+/*! Links appended sc-arcs with their begin and end sc-elements. Sequential sc-arcs with the same begin sc-element are
+ * linked while it and section of appended sc-arcs stay locked. If sc-arc can't be linked, then its slot is released
+ * and its sc-addr becomes empty.
+ * @note All sc-arcs must be appended into the same section, that mustn't be locked.
+ * @returns Number of linked sc-arcs
+ */
+sc_uint32 _sc_storage_arcs_link(
+    sc_memory_context * ctx,
+    sc_type const * types,
+    sc_addr const * begins,
+    sc_addr const * ends,
+    sc_access_levels access_levels,
+    sc_uint32 count,
+    sc_addr * addrs)
+{
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addrs[0].seg]);
+  sc_segment_section * section = sc_segment_get_section(seg, addrs[0].offset);
+  sc_spin_backoff backoff = SC_SPIN_BACKOFF_INIT;
+  sc_uint32 linked = 0;
+  sc_uint32 released = 0;
+  sc_uint32 i = 0;
+
+  while (i < count)
   {
-    if (beg_el != null_ptr)
+    sc_addr const beg = begins[i];
+    sc_element * beg_el = null_ptr;
+    sc_bool is_busy = SC_FALSE;
+
+    // begin element is locked before appended sc-arcs, so thread doesn't hold them while it waits for popular element
+    if (SC_ADDR_IS_NOT_EMPTY(beg) &&
+        sc_storage_element_lock_try(beg, s_max_storage_lock_attempts, &beg_el) == SC_RESULT_OK && beg_el == null_ptr)
+      is_busy = SC_TRUE;
+    else if (sc_segment_section_lock_try(section, s_max_storage_lock_attempts) == SC_FALSE)
     {
-      if (f_out_arc != null_ptr)
-        sc_storage_element_unlock(first_out_arc);
-      sc_storage_element_unlock(beg);
+      if (beg_el != null_ptr)
+        sc_storage_element_unlock(beg);
+      is_busy = SC_TRUE;
     }
-    if (end_el != null_ptr)
+
+    if (is_busy == SC_TRUE)
     {
-      if (f_in_arc != null_ptr)
-        sc_storage_element_unlock(first_in_arc);
-      sc_storage_element_unlock(end);
+      if (sc_spin_backoff_wait(&backoff) == SC_FALSE)
+        g_thread_yield();
+      continue;
     }
 
-    if (tmp_el != null_ptr)
-      sc_storage_element_unlock(addr);
-  }
+    for (; i < count && SC_ADDR_IS_EQUAL(begins[i], beg); ++i)
+    {
+      sc_result r = SC_RESULT_ERROR_INVALID_STATE;
+      if (beg_el != null_ptr && sc_element_is_valid(beg_el) == SC_TRUE)
+      {
+        r = _sc_storage_arc_link_locked(
+            ctx, addrs[i], &seg->elements[addrs[i].offset], types[i], beg, beg_el, ends[i], access_levels);
+        if (r == SC_RESULT_ERROR)
+        {
+          is_busy = SC_TRUE;
+          break;
+        }
+      }
 
-    if (should_break == SC_TRUE)
-      break;
+      if (r == SC_RESULT_OK)
+        ++linked;
+      else
+      {
+        sc_segment_get_meta(seg, addrs[i].offset)->ref_count = 0;
+        sc_storage_erase_element_from_segment(addrs[i]);
+        SC_ADDR_MAKE_EMPTY(addrs[i]);
+        ++released;
+      }
+    }
+
+    // all locks are released before the next attempt, so threads, that lock the same elements, don't wait each other
+    sc_segment_section_unlock(section);
+    if (beg_el != null_ptr)
+      sc_storage_element_unlock(beg);
+
+    if (is_busy == SC_TRUE && sc_spin_backoff_wait(&backoff) == SC_FALSE)
+      g_thread_yield();
   }
 
-  return addr;
+  if (released > 0)
+    _sc_segment_cache_append(seg);
+
+  return linked;
 }
 
-sc_result sc_storage_get_element_type(const sc_memory_context * ctx, sc_addr addr, sc_type * result)
+sc_addr sc_storage_arc_new_ext(
+    sc_memory_context * ctx,
+    sc_type type,
+    sc_addr beg,
+    sc_addr end,
+    sc_access_levels access_levels)
 {
-  sc_element * el = null_ptr;
-  sc_result r = SC_RESULT_OK;
+  sc_addr addr;
 
-  if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
-    return SC_RESULT_ERROR;
+  sc_assert(!(sc_type_node & type));
 
-  if (sc_element_is_valid(el) == SC_FALSE)
+  SC_ADDR_MAKE_EMPTY(addr);
+
+  if (SC_ADDR_IS_EMPTY(beg) || SC_ADDR_IS_EMPTY(end))
+    return addr;
+
+  // get new element before begin and end elements are locked, so they aren't held while segments are searched
+  if (sc_storage_append_el_into_segments(ctx, &addr) != null_ptr)
   {
-    r = SC_RESULT_ERROR_INVALID_STATE;
-    goto unlock;
+    STORAGE_CHECK_CALL(sc_storage_element_unlock(addr));
+    _sc_storage_arcs_link(ctx, &type, &beg, &end, access_levels, 1, &addr);
   }
 
-  if (sc_access_lvl_check_read(ctx->access_levels, el->flags.access_levels))
-    *result = sc_flags_remove(el->flags.type);
-  else
-    r = SC_RESULT_ERROR_NO_READ_RIGHTS;
+  return addr;
+}
 
-unlock:
+sc_uint32 sc_storage_arcs_new_batch(
+    sc_memory_context * ctx,
+    sc_type const * types,
+    sc_addr const * begins,
+    sc_addr const * ends,
+    sc_uint32 count,
+    sc_addr * result)
 {
-  sc_storage_element_unlock(addr);
+  sc_uint32 created = 0;
+  sc_uint32 i = 0;
+  while (i < count)
+  {
+    sc_uint32 const appended = sc_storage_append_els_into_segments(ctx, count - i, result + i);
+    if (appended == 0)
+      break;
+
+    // slots are locked again while sc-arcs are linked
+    STORAGE_CHECK_CALL(sc_storage_element_unlock(result[i]));
+
+    sc_uint32 j;
+    for (j = i; j < i + appended; ++j)
+      sc_assert(!(sc_type_node & types[j]));
+
+    created += _sc_storage_arcs_link(ctx, types + i, begins + i, ends + i, ctx->access_levels, appended, result + i);
+    i += appended;
+  }
+
+  for (; i < count; ++i)
+    SC_ADDR_MAKE_EMPTY(result[i]);
+
+  return created;
 }
-  return r;
+
+sc_result sc_storage_get_element_type(const sc_memory_context * ctx, sc_addr addr, sc_type * result)
+{
+  sc_access_levels levels;
+  return sc_storage_get_element_header(ctx, addr, result, &levels);
 }
 
 sc_result sc_storage_change_element_subtype(const sc_memory_context * ctx, sc_addr addr, sc_type type)
@@ -847,7 +1477,10 @@ sc_result sc_storage_change_element_subtype(const sc_memory_context * ctx, sc_ad
     return SC_RESULT_ERROR_INVALID_PARAMS;
 
   if (sc_access_lvl_check_write(ctx->access_levels, el->flags.access_levels))
+  {
     el->flags.type = type;
+    STORAGE_UPDATE_COLUMNS(addr);
+  }
   else
     r = SC_RESULT_ERROR_NO_WRITE_RIGHTS;
 
@@ -858,12 +1491,56 @@ unlock:
   return r;
 }
 
+#ifdef SC_ARC_HASH_INDEX
+typedef struct _sc_storage_arc_filter_params
+{
+  sc_memory_context const * ctx;
+  sc_type arc_type;
+} sc_storage_arc_filter_params;
+
+sc_bool _sc_storage_arc_filter(sc_addr arc, void * data)
+{
+  sc_storage_arc_filter_params const * params = data;
+
+  sc_element_columns columns;
+  sc_storage_read_element_columns(arc, &columns);
+
+  return (columns.type & sc_flag_request_deletion) == 0 && sc_iterator_compare_type(columns.type, params->arc_type) &&
+         sc_access_lvl_check_read(params->ctx->access_levels, columns.access_levels);
+}
+
+sc_result sc_storage_find_arc(
+    sc_memory_context const * ctx,
+    sc_addr beg,
+    sc_addr end,
+    sc_type arc_type,
+    sc_addr * result)
+{
+  sc_type type;
+  sc_access_levels levels;
+  sc_result r = sc_storage_get_element_header(ctx, beg, &type, &levels);
+  if (r != SC_RESULT_OK)
+    return r;
+
+  r = sc_storage_get_element_header(ctx, end, &type, &levels);
+  if (r != SC_RESULT_OK)
+    return r;
+
+  sc_storage_arc_filter_params params;
+  params.ctx = ctx;
+  params.arc_type = arc_type;
+
+  *result = sc_arc_index_find(beg, end, _sc_storage_arc_filter, &params);
+  return SC_ADDR_IS_NOT_EMPTY(*result) ? SC_RESULT_OK : SC_RESULT_NO;
+}
+#endif
+
 sc_result sc_storage_get_arc_begin(const sc_memory_context * ctx, sc_addr addr, sc_addr * result)
 {
   sc_element * el = null_ptr;
   sc_result res = SC_RESULT_ERROR_INVALID_TYPE;
 
-  if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
+  if (sc_storage_element_lock_shared(addr, &el) != SC_RESULT_OK)
     return SC_RESULT_ERROR;
 
   if (sc_element_is_valid(el) == SC_FALSE)
@@ -885,7 +1562,7 @@ sc_result sc_storage_get_arc_begin(const sc_memory_context * ctx, sc_addr addr,
 
 unlock:
 {
-  sc_storage_element_unlock(addr);
+  sc_storage_element_unlock_shared(addr);
 }
   return res;
 }
@@ -895,7 +1572,7 @@ sc_result sc_storage_get_arc_end(const sc_memory_context * ctx, sc_addr addr, sc
   sc_element * el = null_ptr;
   sc_result res = SC_RESULT_ERROR_INVALID_TYPE;
 
-  if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
+  if (sc_storage_element_lock_shared(addr, &el) != SC_RESULT_OK)
     return SC_RESULT_ERROR;
 
   if (sc_element_is_valid(el) == SC_FALSE)
@@ -917,7 +1594,7 @@ sc_result sc_storage_get_arc_end(const sc_memory_context * ctx, sc_addr addr, sc
 
 unlock:
 {
-  sc_storage_element_unlock(addr);
+  sc_storage_element_unlock_shared(addr);
 }
   return res;
 }
@@ -931,7 +1608,7 @@ sc_result sc_storage_get_arc_info(
   sc_element * el = null_ptr;
   sc_result res = SC_RESULT_ERROR_INVALID_TYPE;
 
-  if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
+  if (sc_storage_element_lock_shared(addr, &el) != SC_RESULT_OK)
     return SC_RESULT_ERROR;
 
   if (sc_element_is_valid(el) == SC_FALSE)
@@ -954,7 +1631,7 @@ sc_result sc_storage_get_arc_info(
 
 unlock:
 {
-  sc_storage_element_unlock(addr);
+  sc_storage_element_unlock_shared(addr);
 }
   return res;
 }
@@ -1012,6 +1689,7 @@ sc_result sc_storage_set_link_content_ext(
   else
   {
     el->flags.type |= sc_flag_link_self_container;
+    STORAGE_UPDATE_COLUMNS(addr);
 
     if (string == null_ptr)
       sc_string_empty(string);
@@ -1023,7 +1701,8 @@ sc_result sc_storage_set_link_content_ext(
 
   sc_addr empty;
   SC_ADDR_MAKE_EMPTY(empty);
-  sc_event_emit(ctx, addr, access_lvl, SC_EVENT_CONTENT_CHANGED, empty, empty);
+  if (sc_storage_element_has_events(addr, SC_EVENT_CONTENT_CHANGED))
+    sc_event_emit(ctx, addr, access_lvl, SC_EVENT_CONTENT_CHANGED, empty, empty);
 
 unlock:
 {
@@ -1184,6 +1863,7 @@ sc_result sc_storage_set_access_levels(
   if (sc_access_lvl_check_write(ctx->access_levels, el->flags.access_levels))
   {
     el->flags.access_levels = sc_access_lvl_min(ctx->access_levels, access_levels);
+    STORAGE_UPDATE_COLUMNS(addr);
     if (new_value)
       *new_value = el->flags.access_levels;
   }
@@ -1200,7 +1880,7 @@ sc_result sc_storage_get_access_levels(const sc_memory_context * ctx, sc_addr ad
   sc_element * el = null_ptr;
   sc_result r = SC_RESULT_OK;
 
-  if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
+  if (sc_storage_element_lock_shared(addr, &el) != SC_RESULT_OK)
     return SC_RESULT_ERROR;
 
   if (sc_access_lvl_check_read(ctx->access_levels, el->flags.access_levels))
@@ -1210,10 +1890,29 @@ sc_result sc_storage_get_access_levels(const sc_memory_context * ctx, sc_addr ad
   else
     r = SC_RESULT_ERROR_NO_READ_RIGHTS;
 
-  STORAGE_CHECK_CALL(sc_storage_element_unlock(addr));
+  STORAGE_CHECK_CALL(sc_storage_element_unlock_shared(addr));
   return r;
 }
 
+sc_result sc_storage_get_element_header(
+    sc_memory_context const * ctx,
+    sc_addr addr,
+    sc_type * type,
+    sc_access_levels * access_levels)
+{
+  sc_element_columns columns;
+  sc_result const r = _sc_storage_read_element_header(addr, &columns);
+  if (r != SC_RESULT_OK)
+    return r;
+
+  if (!sc_access_lvl_check_read(ctx->access_levels, columns.access_levels))
+    return SC_RESULT_ERROR_NO_READ_RIGHTS;
+
+  *type = sc_flags_remove(columns.type);
+  *access_levels = columns.access_levels;
+  return SC_RESULT_OK;
+}
+
 sc_result sc_storage_get_elements_stat(sc_stat * stat)
 {
   sc_assert(stat != null_ptr);
@@ -1242,6 +1941,40 @@ sc_result sc_storage_erase_element_from_segment(sc_addr addr)
   return SC_RESULT_OK;
 }
 
+void sc_storage_read_element_columns(sc_addr addr, sc_element_columns * columns)
+{
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  sc_assert(seg != null_ptr);
+  sc_storage_get_element_columns(addr, &seg->elements[addr.offset], columns);
+}
+
+sc_addr sc_storage_read_prev_arc(sc_addr addr, sc_bool is_output)
+{
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  sc_assert(seg != null_ptr);
+  sc_arc_info const * arc = &seg->elements[addr.offset].arc;
+  return is_output ? arc->prev_out_arc : arc->prev_in_arc;
+}
+
+#ifdef SC_ARC_TYPE_INDEX
+void sc_storage_read_element_typed_arcs(sc_addr addr, sc_element_typed_arcs * typed_arcs)
+{
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  sc_assert(seg != null_ptr);
+  *typed_arcs = seg->typed_arcs[addr.offset];
+}
+#endif
+
+void sc_storage_get_element_columns(sc_addr addr, sc_element * el, sc_element_columns * columns)
+{
+  sc_assert(el != null_ptr);
+#ifdef SC_SEGMENT_COLUMNS
+  *columns = *sc_segment_get_columns(sc_atomic_pointer_get((void **)&segments[addr.seg]), addr.offset);
+#else
+  sc_element_get_columns(el, columns);
+#endif
+}
+
 // ------------------------------
 sc_element_meta * sc_storage_get_element_meta(sc_addr addr)
 {
@@ -1251,6 +1984,37 @@ sc_element_meta * sc_storage_get_element_meta(sc_addr addr)
   return sc_segment_get_meta(segment, addr.offset);
 }
 
+void sc_storage_set_element_events_mask(sc_addr addr, sc_uint8 mask)
+{
+  sc_assert(addr.seg < SC_ADDR_SEG_MAX && addr.offset < SC_SEGMENT_ELEMENTS_COUNT);
+  sc_segment * segment = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  sc_assert(segment != null_ptr);
+  *(sc_uint8 volatile *)&segment->meta[addr.offset].events_mask = mask;
+}
+
+sc_uint8 sc_storage_get_element_events_mask(sc_addr addr)
+{
+  if (addr.seg >= SC_ADDR_SEG_MAX || addr.offset >= SC_SEGMENT_ELEMENTS_COUNT)
+    return 0;
+
+  sc_segment * segment = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  if (segment == null_ptr)
+    return 0;
+
+  // bit is set before sc-event is added into table, so emitter can miss just sc-events, that are subscribed
+  // concurrently with emit
+  return *(sc_uint8 volatile *)&segment->meta[addr.offset].events_mask;
+}
+
+sc_bool sc_storage_element_has_events(sc_addr addr, sc_event_type type)
+{
+  // events mask has a bit for each of sc-event types
+  if (type < 0 || (sc_uint32)type >= sizeof(sc_uint8) * 8)
+    return SC_FALSE;
+
+  return (sc_storage_get_element_events_mask(addr) & (1u << type)) != 0 ? SC_TRUE : SC_FALSE;
+}
+
 sc_result sc_storage_element_lock(sc_addr addr, sc_element ** el)
 {
   if (addr.seg >= SC_ADDR_SEG_MAX)
@@ -1304,16 +2068,53 @@ sc_result sc_storage_element_unlock(sc_addr addr)
   return SC_RESULT_OK;
 }
 
+sc_result sc_storage_element_lock_shared(sc_addr addr, sc_element ** el)
+{
+  if (addr.seg >= SC_ADDR_SEG_MAX)
+  {
+    *el = null_ptr;
+    return SC_RESULT_ERROR;
+  }
+
+  sc_segment * segment = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  if (segment == null_ptr)
+  {
+    *el = null_ptr;
+    return SC_RESULT_ERROR;
+  }
+
+  *el = sc_segment_lock_element_shared(segment, addr.offset);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_storage_element_unlock_shared(sc_addr addr)
+{
+  sc_segment * segment = null_ptr;
+
+  if (addr.seg >= SC_ADDR_SEG_MAX)
+    return SC_RESULT_ERROR;
+
+  segment = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  if (segment == null_ptr)
+    return SC_RESULT_ERROR;
+
+  sc_segment_unlock_element_shared(segment, addr.offset);
+  return SC_RESULT_OK;
+}
+
 sc_result sc_storage_save(sc_memory_context const * ctx)
 {
   sc_segment * seg = null_ptr;
   sc_uint32 i;
 
-  // synchronize with free
-  g_mutex_lock(&s_mutex_free);
+  // erased sc-elements, that aren't read by iterators, aren't saved
+  sc_storage_reclaim_elements(SC_TRUE);
+
   g_mutex_lock(&s_mutex_save);
 
-  for (i = 0; i < segments_num; ++i)
+  // segments, that are created while saving, are fully constructed, so it is enough to save published ones
+  sc_uint32 const num = sc_atomic_int_get(&segments_num);
+  for (i = 0; i < num; ++i)
   {
     seg = segments[i];
     if (seg == null_ptr)
@@ -1322,11 +2123,9 @@ sc_result sc_storage_save(sc_memory_context const * ctx)
     sc_segment_lock(seg);
   }
 
-  sc_fs_memory_save(segments, segments_num);
-
-  g_mutex_unlock(&s_mutex_free);
+  sc_fs_memory_save(segments, num);
 
-  for (i = 0; i < segments_num; ++i)
+  for (i = 0; i < num; ++i)
   {
     seg = segments[i];
     if (seg == null_ptr)
@@ -1344,51 +2143,174 @@ sc_bool _sc_storage_ref_common(sc_addr addr, int dir)
 {
   sc_assert(dir == 1 || dir == -1);
   sc_assert(SC_ADDR_IS_NOT_EMPTY(addr));
-  sc_element * el = null_ptr;
-  sc_uint32 new_ref = 0;
 
-  if (sc_storage_element_lock(addr, &el) == SC_RESULT_OK)
+  // element can't be erased, while it's locked or referenced, so its counter can be changed without lock
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  sc_assert(seg != null_ptr);
+  sc_element_meta * meta = &seg->meta[addr.offset];
+
+  sc_int32 const old_ref = sc_atomic_int_add(&meta->ref_count, dir);
+  sc_assert(old_ref + dir >= 0);
+  sc_assert(old_ref < G_MAXINT32);
+
+  return (old_ref + dir == 0) ? SC_TRUE : SC_FALSE;
+}
+
+void sc_storage_element_ref(sc_addr addr)
+{
+  _sc_storage_ref_common(addr, 1);
+}
+
+void _sc_storage_retire_element(sc_addr addr)
+{
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  sc_element_meta * meta = &seg->meta[addr.offset];
+
+  g_mutex_lock(&s_retired_mutex);
+
+  // sc-element was referenced and unreferenced again, while it waited for recycling
+  if (meta->retired == SC_TRUE)
   {
-    sc_assert(el != null_ptr);
-    sc_element_meta * meta = sc_storage_get_element_meta(addr);
+    g_mutex_unlock(&s_retired_mutex);
+    return;
+  }
+  meta->retired = SC_TRUE;
 
-    sc_assert(meta != null_ptr);
-    sc_assert(meta->ref_count > 0);
-    sc_assert(meta->ref_count + dir < G_MAXUINT32);
-    sc_assert(sizeof(meta->ref_count) == 4);
+  sc_uint32 const count = (sc_uint32)s_retired_count;
+  if (s_retired_head + count == s_retired_capacity)
+  {
+    // list is moved to its beginning, only when recycled head isn't shorter than the rest, so moves are amortized
+    if (s_retired_head != 0 && s_retired_head >= count)
+    {
+      memmove(s_retired_elements, s_retired_elements + s_retired_head, count * sizeof(sc_storage_retired_element));
+      s_retired_head = 0;
+    }
+    else
+    {
+      s_retired_capacity = s_retired_capacity == 0 ? 1024 : s_retired_capacity * 2;
+      s_retired_elements = sc_mem_renew(s_retired_elements, sc_storage_retired_element, s_retired_capacity);
+    }
+  }
 
-    meta->ref_count += dir;
-    new_ref = meta->ref_count;
+  sc_storage_retired_element * retired = &s_retired_elements[s_retired_head + count];
+  retired->addr = addr;
+  retired->epoch = sc_epoch_get();
+  sc_atomic_int_inc(&s_retired_count);
 
-    sc_storage_element_unlock(addr);
+  // epoch isn't advanced, while any iterator isn't finished or destroyed, so its list grows without bound
+  if (count + 1 == s_retired_warning_count)
+  {
+    sc_warning(
+        "%u erased sc-elements wait for recycling, some iterator may be neither finished nor destroyed",
+        s_retired_warning_count);
+    s_retired_warning_count *= 2;
   }
-  else
+
+  g_mutex_unlock(&s_retired_mutex);
+}
+
+void _sc_storage_recycle_element(sc_addr addr)
+{
+  sc_element * el = null_ptr;
+  if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
+    sc_critical("Invalid state of sc-element");
+
+  sc_segment * seg = sc_atomic_pointer_get((void **)&segments[addr.seg]);
+  sc_element_meta * meta = &seg->meta[addr.offset];
+
+  // sc-element can be referenced without lock after it was retired, then it's retired again by its last unref. Slot
+  // is erased under retired list lock, so sc-element can't be retired again, while it's recycled
+  g_mutex_lock(&s_retired_mutex);
+  meta->retired = SC_FALSE;
+  sc_bool const is_referenced = sc_atomic_int_get(&meta->ref_count) != 0;
+  if (is_referenced == SC_FALSE)
+    sc_storage_erase_element_from_segment(addr);
+  g_mutex_unlock(&s_retired_mutex);
+
+  if (is_referenced == SC_TRUE)
   {
-    sc_critical("Critical error, while add reference to an element (can't lock)");
+    sc_storage_element_unlock(addr);
+    return;
   }
 
-  return (new_ref == 0) ? SC_TRUE : SC_FALSE;
+  _sc_segment_cache_append(seg);
+
+  sc_storage_element_unlock(addr);
+
+  // return pages of segment, that became empty, to OS
+  if (sc_segment_get_elements_count(seg) == 0)
+    sc_segment_release_memory(seg);
 }
 
-void sc_storage_element_ref(sc_addr addr)
+//! Returns SC_TRUE, if the oldest retired sc-element can be recycled. It's called under retired list lock
+sc_bool _sc_storage_can_reclaim_elements()
 {
-  _sc_storage_ref_common(addr, 1);
+  sc_uint32 const epoch = s_retired_elements[s_retired_head].epoch;
+  if (sc_epoch_is_safe(epoch) == SC_TRUE)
+    return SC_TRUE;
+
+  // sc-elements, that were retired in the current epoch, become safe after two advances. Epoch isn't advanced, while
+  // some reader, for example iterator of caller, is in the previous one, so the second scan is skipped
+  sc_uint32 const current = sc_epoch_get();
+  if (sc_epoch_try_advance() == current)
+    return SC_FALSE;
+
+  sc_epoch_try_advance();
+  return sc_epoch_is_safe(epoch);
 }
 
-sc_bool sc_storage_element_unref(sc_addr addr)
+void sc_storage_reclaim_elements(sc_bool force)
 {
-  sc_bool const no_refs = _sc_storage_ref_common(addr, -1);
-  if (no_refs == SC_TRUE)
+  sc_int32 const retired_count = sc_atomic_int_get(&s_retired_count);
+  if (retired_count == 0 || (force == SC_FALSE && retired_count < SC_STORAGE_RECLAIM_THRESHOLD))
+    return;
+
+  // another thread reclaims them now
+  if (g_mutex_trylock(&s_reclaim_mutex) == FALSE)
+    return;
+
+  g_mutex_lock(&s_retired_mutex);
+
+  sc_uint32 i;
+  sc_uint32 const count = (sc_uint32)s_retired_count;
+  sc_uint32 recycled_count = 0;
+  if (count > 0 && _sc_storage_can_reclaim_elements() == SC_TRUE)
   {
-    sc_element * el = null_ptr;
-    if (sc_storage_element_lock(addr, &el) != SC_RESULT_OK)
-      sc_critical("Invalid state of sc-element");
+    // retired list is ordered by epochs, so safe sc-elements are at its beginning
+    sc_storage_retired_element const * retired = s_retired_elements + s_retired_head;
+    while (recycled_count < count && sc_epoch_is_safe(retired[recycled_count].epoch) == SC_TRUE)
+      ++recycled_count;
 
-    sc_storage_erase_element_from_segment(addr);
-    _sc_segment_cache_append(sc_atomic_pointer_get((void **)&segments[addr.seg]));
+    if (recycled_count > s_reclaimed_capacity)
+    {
+      s_reclaimed_capacity = sc_max(recycled_count, s_reclaimed_capacity * 2);
+      s_reclaimed_elements = sc_mem_renew(s_reclaimed_elements, sc_addr, s_reclaimed_capacity);
+    }
 
-    sc_storage_element_unlock(addr);
+    for (i = 0; i < recycled_count; ++i)
+      s_reclaimed_elements[i] = retired[i].addr;
+
+    s_retired_head = recycled_count == count ? 0 : s_retired_head + recycled_count;
+    sc_atomic_int_set(&s_retired_count, (sc_int32)(count - recycled_count));
+    if (count - recycled_count < SC_STORAGE_RETIRED_WARNING_COUNT)
+      s_retired_warning_count = SC_STORAGE_RETIRED_WARNING_COUNT;
   }
 
+  // recycling locks sc-elements, and eraser locks this mutex, while it holds their locks
+  g_mutex_unlock(&s_retired_mutex);
+
+  for (i = 0; i < recycled_count; ++i)
+    _sc_storage_recycle_element(s_reclaimed_elements[i]);
+
+  g_mutex_unlock(&s_reclaim_mutex);
+}
+
+sc_bool sc_storage_element_unref(sc_addr addr)
+{
+  sc_bool const no_refs = _sc_storage_ref_common(addr, -1);
+  // slot keeps data, while threads, that could reach it without lock, are in their epochs
+  if (no_refs == SC_TRUE)
+    _sc_storage_retire_element(addr);
+
   return no_refs;
 }
@@ -43,6 +43,14 @@ sc_bool sc_storage_is_initialized();
  */
 sc_element * sc_storage_append_el_into_segments(const sc_memory_context * ctx, sc_addr * addr);
 
+/*! Append up to count sc-elements into the same section of one segment
+ * @param addrs Pointer to array of count sc-addrs, that will contain sc-addrs of appended sc-elements
+ * @return Return number of appended sc-elements, it isn't greater than SC_STORAGE_APPEND_BATCH_SIZE.
+ * @note Appended sc-elements are locked with one section lock, so they should be unlocked with one
+ * sc_storage_element_unlock call for any of them
+ */
+sc_uint32 sc_storage_append_els_into_segments(const sc_memory_context * ctx, sc_uint32 count, sc_addr * addrs);
+
 /*! Check if sc-element with specified sc-addr exist
  * @param addr sc-addr of element
  * @return Returns SC_TRUE, if sc-element with \p addr exist; otherwise return false.
@@ -50,10 +58,31 @@ sc_element * sc_storage_append_el_into_segments(const sc_memory_context * ctx, s
  */
 sc_bool sc_storage_is_element(const sc_memory_context * ctx, sc_addr addr);
 
+//! Returns number of output arcs of sc-element. It's read without locks, so it can be used to plan searches
 sc_uint32 sc_storage_get_element_output_arcs_count(const sc_memory_context * ctx, sc_addr addr);
 
+//! Returns number of input arcs of sc-element. It's read without locks, so it can be used to plan searches
 sc_uint32 sc_storage_get_element_input_arcs_count(const sc_memory_context * ctx, sc_addr addr);
 
+/*! Returns number of output arcs of sc-element, that can have specified type, without locks. When sc-memory is built
+ * with SC_ARC_TYPE_INDEX, arcs are counted by their kinds (common edges, common arcs and access arcs), so arcs of other
+ * kinds aren't counted; otherwise all arcs are counted.
+ * @param arc_type Type of arcs to count, all arcs are counted for 0
+ * @returns Upper bound of number of arcs with \p arc_type. It doesn't take constancy and other flags into account
+ */
+sc_uint32 sc_storage_get_element_output_arcs_count_by_type(
+    const sc_memory_context * ctx,
+    sc_addr addr,
+    sc_type arc_type);
+
+/*! Returns number of input arcs of sc-element, that can have specified type, without locks
+ * (see sc_storage_get_element_output_arcs_count_by_type)
+ */
+sc_uint32 sc_storage_get_element_input_arcs_count_by_type(
+    const sc_memory_context * ctx,
+    sc_addr addr,
+    sc_type arc_type);
+
 /*! Create new sc-element in storage.
  * Only for internal usage.
  */
@@ -66,6 +95,22 @@ sc_addr sc_storage_element_new_access(const sc_memory_context * ctx, sc_type typ
  */
 sc_result sc_storage_element_free(sc_memory_context * ctx, sc_addr addr);
 
+/*! Remove several sc-elements from storage with one pass of locking. Sc-elements and their connectors are locked once
+ * in order of their sections, and events of deletion are emitted together.
+ * @param addrs Array of \p count sc-addrs of elements to erase. Sc-elements, that don't exist, are skipped
+ * @return If sc-elements erased, then return SC_RESULT_OK; if context has no write rights for any of them, then
+ * nothing is erased and SC_RESULT_ERROR_NO_WRITE_RIGHTS is returned
+ */
+sc_result sc_storage_elements_free_batch(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count);
+
+/*! Buffers of sc-elements deletion, that are reused by deletions in the same memory context. Deletion takes them from
+ * context for its duration, so concurrent deletions with the same context use separate buffers
+ */
+typedef struct _sc_storage_free_arena sc_storage_free_arena;
+
+//! Frees buffers of sc-elements deletion. Arena may be null
+void sc_storage_free_arena_destroy(sc_storage_free_arena * arena);
+
 /*! Create new sc-node
  * @param type Type of new sc-node
  * @return Return sc-addr of created sc-node or empty sc-addr if sc-node wasn't created
@@ -75,6 +120,17 @@ sc_addr sc_storage_node_new(const sc_memory_context * ctx, sc_type type);
 //! Create new sc-node with specified access level
 sc_addr sc_storage_node_new_ext(const sc_memory_context * ctx, sc_type type, sc_access_levels access_levels);
 
+/*! Create count new sc-nodes. Nodes are placed into ranges of neighbour slots, and each range is locked once.
+ * @param types Pointer to array of count types of new sc-nodes
+ * @param result Pointer to array of count sc-addrs, that will contain sc-addrs of created sc-nodes
+ * @return Return number of created sc-nodes. If it is less than count, then the rest of result sc-addrs are empty
+ */
+sc_uint32 sc_storage_nodes_new_batch(
+    const sc_memory_context * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * result);
+
 /*! Create new sc-link
  * @return Return sc-addr of created sc-link or empty sc-addr if sc-link wasn't created
  */
@@ -100,6 +156,22 @@ sc_addr sc_storage_arc_new_ext(
     sc_addr end,
     sc_access_levels access_levels);
 
+/*! Create count new sc-arcs. Slots for them are reserved by ranges before any begin or end sc-element is locked.
+ * @param types Pointer to array of count types of new sc-arcs
+ * @param begins Pointer to array of count sc-addrs of begin sc-elements
+ * @param ends Pointer to array of count sc-addrs of end sc-elements
+ * @param result Pointer to array of count sc-addrs, that will contain sc-addrs of created sc-arcs. If sc-arc
+ * wasn't created, then its sc-addr is empty
+ * @return Return number of created sc-arcs
+ */
+sc_uint32 sc_storage_arcs_new_batch(
+    sc_memory_context * ctx,
+    sc_type const * types,
+    sc_addr const * begins,
+    sc_addr const * ends,
+    sc_uint32 count,
+    sc_addr * result);
+
 /*! Get type of sc-element with specified sc-addr
  * @param addr sc-addr of element to get type
  * @param result Pointer to result container
@@ -115,6 +187,20 @@ sc_result sc_storage_get_element_type(sc_memory_context const * ctx, sc_addr add
  */
 sc_result sc_storage_change_element_subtype(sc_memory_context const * ctx, sc_addr addr, sc_type type);
 
+#ifdef SC_ARC_HASH_INDEX
+/*! Finds sc-arc with specified type between sc-elements by hash index, without walking their lists of arcs
+ * @param arc_type Type of sc-arc to find, it's compared as in iterators
+ * @param result Pointer to result container
+ * @return If sc-arc is found, then return SC_RESULT_OK; if there is no such sc-arc, then return SC_RESULT_NO
+ */
+sc_result sc_storage_find_arc(
+    sc_memory_context const * ctx,
+    sc_addr beg,
+    sc_addr end,
+    sc_type arc_type,
+    sc_addr * result);
+#endif
+
 /*! Returns sc-addr of begin element of specified arc
  * @param addr sc-addr of arc to get begin element
  * @param result Pointer to result container
@@ -244,6 +330,21 @@ sc_result sc_storage_set_access_levels(
 //! Get access levels of sc-element
 sc_result sc_storage_get_access_levels(sc_memory_context const * ctx, sc_addr addr, sc_access_levels * result);
 
+/*! Gets type and access levels of sc-element by one read without lock. It's used instead of separate
+ * sc_storage_is_element, sc_storage_get_element_type and sc_storage_get_access_levels calls, that lock sc-element
+ * each
+ * @param type Pointer to result container for type of sc-element without flags
+ * @param access_levels Pointer to result container for access levels
+ * @return If sc-element exists and can be read in \p ctx, then return SC_RESULT_OK; if it doesn't exist or it's
+ * deleted, then return SC_RESULT_ERROR_INVALID_STATE; if \p ctx has no rights to read it, then return
+ * SC_RESULT_ERROR_NO_READ_RIGHTS; if \p addr is invalid, then return SC_RESULT_ERROR
+ */
+sc_result sc_storage_get_element_header(
+    sc_memory_context const * ctx,
+    sc_addr addr,
+    sc_type * type,
+    sc_access_levels * access_levels);
+
 //! Returns number of segments
 sc_uint sc_storage_get_segments_count();
 
@@ -256,6 +357,35 @@ sc_result sc_storage_get_elements_stat(sc_stat * stat);
 
 sc_result sc_storage_erase_element_from_segment(sc_addr addr);
 
+/*! Reads fields of locked sc-element, that are used to traverse lists of arcs
+ * @param addr sc-addr of locked sc-element
+ * @param el Pointer to locked sc-element
+ * @param columns Pointer to result container
+ */
+void sc_storage_get_element_columns(sc_addr addr, sc_element * el, sc_element_columns * columns);
+
+/*! Reads fields of sc-element, that are used to traverse lists of arcs, without lock. Fields can be changed
+ * concurrently, but sc-element slot isn't recycled, while reader is in epoch (see sc_epoch_enter)
+ * @param addr sc-addr of sc-element, that was reached in the current epoch
+ * @param columns Pointer to result container
+ */
+void sc_storage_read_element_columns(sc_addr addr, sc_element_columns * columns);
+
+/*! Reads previous arc of sc-arc in output or input list of arcs without lock, as sc_storage_read_element_columns does
+ * @param addr sc-addr of sc-arc, that was reached in the current epoch
+ * @param is_output SC_TRUE, if previous arc in output list of arc begin is read; otherwise previous arc in input list
+ * of arc end is read
+ */
+sc_addr sc_storage_read_prev_arc(sc_addr addr, sc_bool is_output);
+
+#ifdef SC_ARC_TYPE_INDEX
+/*! Reads index of sc-element arcs by their types without lock, as sc_storage_read_element_columns does
+ * @param addr sc-addr of sc-element, that was reached in the current epoch
+ * @param typed_arcs Pointer to result container
+ */
+void sc_storage_read_element_typed_arcs(sc_addr addr, sc_element_typed_arcs * typed_arcs);
+#endif
+
 // ----- Locks -----
 //! Returns pointer to sc-element metainfo
 sc_element_meta * sc_storage_get_element_meta(sc_addr addr);
@@ -266,16 +396,42 @@ sc_result sc_storage_element_lock(sc_addr addr, sc_element ** el);
 sc_result sc_storage_element_lock_try(sc_addr addr, sc_uint16 max_attempts, sc_element ** el);
 //! Unlocks specified sc-element
 sc_result sc_storage_element_unlock(sc_addr addr);
+/*! Locks specified sc-element for reading. Readers of sc-elements don't block each other.
+ * @note Don't change sc-element and don't lock any other sc-elements, while it is locked for reading
+ */
+sc_result sc_storage_element_lock_shared(sc_addr addr, sc_element ** el);
+//! Unlocks sc-element, that was locked for reading
+sc_result sc_storage_element_unlock_shared(sc_addr addr);
+
+/*! Sets mask of sc-event types, that are subscribed for sc-element, bit of type is (1 << type). Mask is kept in
+ * metainfo, so it isn't saved with sc-element
+ * @note It's changed under lock of events table shard, that contains sc-element
+ */
+void sc_storage_set_element_events_mask(sc_addr addr, sc_uint8 mask);
+//! Returns mask of sc-event types, that are subscribed for sc-element, without locks
+sc_uint8 sc_storage_get_element_events_mask(sc_addr addr);
+//! Checks without locks, if sc-element has subscribed sc-events of specified type
+sc_bool sc_storage_element_has_events(sc_addr addr, sc_event_type type);
 
 //! Adds reference to a specified sc-element
 void sc_storage_element_ref(sc_addr addr);
 /*! Removes reference from a specified sc-element
  * @param addr sc_addr of element to remove reference
- * @return If last reference removed from sc-element, then elements cell frees and this function returns SC_TRUE;
+ * @return If last reference removed from sc-element, then elements cell is retired and this function returns SC_TRUE;
  * otherwise - returns SC_FALSE and element is still alive. DO NOT work with this sc-element if function returns SC_TRUE
+ * @note Retired cell is recycled by sc_storage_reclaim_elements, when none of threads can read it without lock
  */
 sc_bool sc_storage_element_unref(sc_addr addr);
 
+/*! Recycles cells of retired sc-elements, that can't be read by readers in epochs. It locks sc-elements, so it
+ * mustn't be called, while thread holds locks of any sc-elements
+ * @param force If it's SC_FALSE, then sc-elements are recycled, only when at least SC_STORAGE_RECLAIM_THRESHOLD of
+ * them are retired
+ * @note Sc-elements, that were retired after any iterator entered its epoch, aren't recycled until it's finished or
+ * destroyed, so iterators shouldn't be kept unfinished. Warning is logged, when too many sc-elements wait for recycling
+ */
+void sc_storage_reclaim_elements(sc_bool force);
+
 sc_result sc_storage_save(sc_memory_context const * ctx);
 
 #endif
@@ -239,6 +239,8 @@ typedef struct _sc_element_refs sc_element_refs;
 typedef struct _sc_memory_context sc_memory_context;
 typedef struct _sc_element_meta sc_element_meta;
 typedef struct _sc_element sc_element;
+typedef struct _sc_element_columns sc_element_columns;
+typedef struct _sc_element_typed_arcs sc_element_typed_arcs;
 typedef struct _sc_segment sc_segment;
 typedef struct _sc_addr sc_addr;
 typedef struct _sc_elements_stat sc_elements_stat;
@@ -249,5 +251,6 @@ typedef struct _sc_event sc_event;
 typedef enum _sc_result sc_result;
 typedef enum _sc_event_type sc_event_type;
 typedef struct _sc_stat sc_stat;
+typedef struct _sc_epoch_record sc_epoch_record;
 
 #define sc_thread() (sc_pointer) g_thread_self()
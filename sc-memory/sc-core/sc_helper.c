@@ -13,6 +13,7 @@
 #include "sc-store/sc-base/sc_allocator.h"
 #include "sc-store/sc-base/sc_assert_utils.h"
 #include "sc-store/sc-base/sc_message.h"
+#include "sc-store/sc_storage.h"
 
 // sc-helper initialization flag
 sc_bool sc_helper_is_initialized = SC_FALSE;
@@ -395,16 +396,21 @@ sc_bool sc_helper_check_arc(sc_memory_context const * ctx, sc_addr beg_el, sc_ad
 {
   sc_assert(ctx != null_ptr);
 
-  sc_iterator3 * it = null_ptr;
+#ifdef SC_ARC_HASH_INDEX
+  sc_addr arc;
+  return sc_storage_find_arc(ctx, beg_el, end_el, arc_type, &arc) == SC_RESULT_OK;
+#else
+  sc_iterator3 storage;
   sc_bool res = SC_FALSE;
 
-  it = sc_iterator3_f_a_f_new(ctx, beg_el, arc_type, end_el);
+  sc_iterator3 * it = sc_iterator3_f_a_f_init(&storage, ctx, beg_el, arc_type, end_el);
   if (it == null_ptr)
     return SC_FALSE;
 
   if (sc_iterator3_next(it) == SC_TRUE)
     res = SC_TRUE;
 
-  sc_iterator3_free(it);
+  sc_iterator3_destroy(it);
   return res;
+#endif
 }
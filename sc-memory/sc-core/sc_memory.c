@@ -49,6 +49,7 @@ sc_memory_context * sc_memory_initialize(const sc_memory_params * params)
   sc_memory_info("Configuration:");
   sc_message("\tMax loaded segments: %d", params->max_loaded_segments);
   sc_message("\tMax threads: %d", params->max_threads);
+  sc_message("\tConcurrency level: %d", params->concurrency_level);
   sc_message("\tSc-element size: %zd", sizeof(sc_element));
 
   sc_memory_info("Build configuration:");
@@ -74,7 +75,7 @@ sc_memory_context * sc_memory_initialize(const sc_memory_params * params)
   }
   sc_memory_context_free(helper_ctx);
 
-  if (sc_events_initialize_ext(params->max_events_and_agents_threads) == SC_FALSE)
+  if (sc_events_initialize_ext(params->max_events_and_agents_threads, params->ordered_events_delivery) == SC_FALSE)
   {
     sc_memory_error("Error while initialize events module");
     goto error;
@@ -228,6 +229,7 @@ void sc_memory_context_free_impl(sc_memory_context * ctx)
 
   g_mutex_unlock(&s_concurrency_mutex);
 
+  sc_storage_free_arena_destroy(ctx->free_arena);
   sc_mem_free(ctx);
 }
 
@@ -290,16 +292,46 @@ sc_uint32 sc_memory_get_element_input_arcs_count(sc_memory_context const * ctx,
   return sc_storage_get_element_input_arcs_count(ctx, addr);
 }
 
+sc_uint32 sc_memory_get_element_output_arcs_count_by_type(
+    sc_memory_context const * ctx,
+    sc_addr addr,
+    sc_type arc_type)
+{
+  return sc_storage_get_element_output_arcs_count_by_type(ctx, addr, arc_type);
+}
+
+sc_uint32 sc_memory_get_element_input_arcs_count_by_type(
+    sc_memory_context const * ctx,
+    sc_addr addr,
+    sc_type arc_type)
+{
+  return sc_storage_get_element_input_arcs_count_by_type(ctx, addr, arc_type);
+}
+
 sc_result sc_memory_element_free(sc_memory_context * ctx, sc_addr addr)
 {
   return sc_storage_element_free(ctx, addr);
 }
 
+sc_result sc_memory_elements_free_batch(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count)
+{
+  return sc_storage_elements_free_batch(ctx, addrs, count);
+}
+
 sc_addr sc_memory_node_new(const sc_memory_context * ctx, sc_type type)
 {
   return sc_storage_node_new(ctx, type);
 }
 
+sc_uint32 sc_memory_nodes_new_batch(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * result)
+{
+  return sc_storage_nodes_new_batch(ctx, types, count, result);
+}
+
 sc_addr sc_memory_link_new(sc_memory_context const * ctx)
 {
   return sc_memory_link_new2(ctx, SC_TRUE);
@@ -315,6 +347,17 @@ sc_addr sc_memory_arc_new(sc_memory_context * ctx, sc_type type, sc_addr beg, sc
   return sc_storage_arc_new(ctx, type, beg, end);
 }
 
+sc_uint32 sc_memory_arcs_new_batch(
+    sc_memory_context * ctx,
+    sc_type const * types,
+    sc_addr const * begins,
+    sc_addr const * ends,
+    sc_uint32 count,
+    sc_addr * result)
+{
+  return sc_storage_arcs_new_batch(ctx, types, begins, ends, count, result);
+}
+
 sc_result sc_memory_get_element_type(sc_memory_context const * ctx, sc_addr addr, sc_type * result)
 {
   return sc_storage_get_element_type(ctx, addr, result);
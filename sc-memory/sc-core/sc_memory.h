@@ -75,9 +75,32 @@ _SC_EXTERN sc_uint32 sc_memory_get_element_output_arcs_count(sc_memory_context c
 
 _SC_EXTERN sc_uint32 sc_memory_get_element_input_arcs_count(sc_memory_context const * ctx, sc_addr addr);
 
+/*! Returns upper bound of number of output arcs of sc-element with specified type
+ * (see sc_storage_get_element_output_arcs_count_by_type)
+ */
+_SC_EXTERN sc_uint32 sc_memory_get_element_output_arcs_count_by_type(
+    sc_memory_context const * ctx,
+    sc_addr addr,
+    sc_type arc_type);
+
+/*! Returns upper bound of number of input arcs of sc-element with specified type
+ * (see sc_storage_get_element_output_arcs_count_by_type)
+ */
+_SC_EXTERN sc_uint32 sc_memory_get_element_input_arcs_count_by_type(
+    sc_memory_context const * ctx,
+    sc_addr addr,
+    sc_type arc_type);
+
 //! Remove sc-element from sc-memory
 _SC_EXTERN sc_result sc_memory_element_free(sc_memory_context * ctx, sc_addr addr);
 
+/*! Remove count sc-elements from sc-memory at once. Their connectors and neighbours are locked only once
+ * @param addrs Pointer to array of count sc-addrs of elements to remove. Sc-elements, that don't exist, are skipped
+ * @return Return SC_RESULT_OK, if sc-elements were removed; otherwise nothing is removed and error code is returned
+ * @note This function is a thread safe
+ */
+_SC_EXTERN sc_result sc_memory_elements_free_batch(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count);
+
 /*! Create new sc-node
  * @param type Type of new sc-node
  * @return Return sc-addr of created sc-node
@@ -85,6 +108,18 @@ _SC_EXTERN sc_result sc_memory_element_free(sc_memory_context * ctx, sc_addr add
  */
 _SC_EXTERN sc_addr sc_memory_node_new(sc_memory_context const * ctx, sc_type type);
 
+/*! Create count new sc-nodes
+ * @param types Pointer to array of count types of new sc-nodes
+ * @param result Pointer to array of count sc-addrs of created sc-nodes
+ * @return Return number of created sc-nodes
+ * @note This function is a thread safe
+ */
+_SC_EXTERN sc_uint32 sc_memory_nodes_new_batch(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_uint32 count,
+    sc_addr * result);
+
 //! Create new sc-link
 _SC_EXTERN sc_addr sc_memory_link_new(sc_memory_context const * ctx);
 _SC_EXTERN sc_addr sc_memory_link_new2(sc_memory_context const * ctx, sc_bool is_const);
@@ -99,6 +134,22 @@ _SC_EXTERN sc_addr sc_memory_link_new2(sc_memory_context const * ctx, sc_bool is
  */
 _SC_EXTERN sc_addr sc_memory_arc_new(sc_memory_context * ctx, sc_type type, sc_addr beg, sc_addr end);
 
+/*! Create count new sc-arcs
+ * @param types Pointer to array of count types of new sc-arcs
+ * @param begins Pointer to array of count sc-addrs of begin sc-elements
+ * @param ends Pointer to array of count sc-addrs of end sc-elements
+ * @param result Pointer to array of count sc-addrs of created sc-arcs. If sc-arc wasn't created, then its sc-addr
+ * is empty
+ * @return Return number of created sc-arcs
+ */
+_SC_EXTERN sc_uint32 sc_memory_arcs_new_batch(
+    sc_memory_context * ctx,
+    sc_type const * types,
+    sc_addr const * begins,
+    sc_addr const * ends,
+    sc_uint32 count,
+    sc_addr * result);
+
 /*! Get type of sc-element with specified sc-addr
  * @param addr sc-addr of element to get type
  * @param result Pointer to result container
@@ -25,7 +25,9 @@ void sc_memory_params_clear(sc_memory_params * params)
 
   params->max_loaded_segments = DEFAULT_MAX_LOADED_SEGMENTS;
   params->max_threads = DEFAULT_MAX_THREADS;
+  params->concurrency_level = DEFAULT_CONCURRENCY_LEVEL;
   params->max_events_and_agents_threads = DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS;
+  params->ordered_events_delivery = DEFAULT_ORDERED_EVENTS_DELIVERY;
 
   params->init_memory_generated_structure = (sc_char const *)null_ptr;
   params->init_memory_generated_upload = SC_FALSE;
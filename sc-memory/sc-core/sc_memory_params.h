@@ -15,7 +15,9 @@
 #define DEFAULT_MAX_THREADS 32
 #define DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS 32
 #define DEFAULT_MIN_EVENTS_AND_AGENTS_THREADS 1
+#define DEFAULT_ORDERED_EVENTS_DELIVERY SC_FALSE
 #define DEFAULT_MAX_LOADED_SEGMENTS 1000
+#define DEFAULT_CONCURRENCY_LEVEL 32
 #define DEFAULT_LOG_TYPE "Console"
 #define DEFAULT_LOG_FILE ""
 #define DEFAULT_LOG_LEVEL "Info"
@@ -36,7 +38,9 @@ typedef struct _sc_memory_params
 
   sc_uint32 max_loaded_segments;
   sc_uint8 max_threads;
+  sc_uint32 concurrency_level;  // number of independently locked sections in each segment, rounded up to power of two
   sc_uint32 max_events_and_agents_threads;
+  sc_bool ordered_events_delivery;  // calls of each sc-event are processed one by one in order of their emit
 
   sc_uint32 save_period;
   sc_uint32 update_period;
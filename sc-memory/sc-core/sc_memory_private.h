@@ -36,6 +36,7 @@ struct _sc_memory_context
   sc_access_levels access_levels;
   sc_uint8 flags;
   GSList * pend_events;
+  struct _sc_storage_free_arena * free_arena;  // it's null, while it's used by deletion; changed atomically
 };
 
 extern sc_memory_context * s_memory_default_ctx;
@@ -55,6 +55,26 @@ ScEvent::ScEvent(
       *ctx, *addr, ConvertEventType(eventType), (sc_pointer)this, &ScEvent::Handler, &ScEvent::HandlerDelete);
 }
 
+ScEvent::ScEvent(
+    const ScMemoryContext & ctx,
+    const ScAddr & addr,
+    Type eventType,
+    ScEvent::BatchDelegateFunc func,
+    uint32_t maxBatchSize,
+    uint32_t maxDelayMs)
+{
+  m_batchDelegate = func;
+  m_event = sc_event_new_batch(
+      *ctx,
+      *addr,
+      ConvertEventType(eventType),
+      (sc_pointer)this,
+      &ScEvent::HandlerBatch,
+      &ScEvent::HandlerDelete,
+      maxBatchSize,
+      maxDelayMs);
+}
+
 ScEvent::~ScEvent()
 {
   if (m_event)
@@ -64,6 +84,7 @@ ScEvent::~ScEvent()
 void ScEvent::RemoveDelegate()
 {
   m_delegate = DelegateFunc();
+  m_batchDelegate = BatchDelegateFunc();
 }
 
 sc_result ScEvent::Handler(sc_event const * evt, sc_addr edge, sc_addr other_el)
@@ -79,6 +100,23 @@ sc_result ScEvent::Handler(sc_event const * evt, sc_addr edge, sc_addr other_el)
   return SC_RESULT_ERROR;
 }
 
+sc_result ScEvent::HandlerBatch(sc_event const * evt, sc_event_batch_item const * items, sc_uint32 count)
+{
+  ScEvent * eventObj = (ScEvent *)sc_event_get_data(evt);
+
+  if (eventObj->m_batchDelegate)
+  {
+    std::vector<std::pair<ScAddr, ScAddr>> edges;
+    edges.reserve(count);
+    for (sc_uint32 i = 0; i < count; ++i)
+      edges.emplace_back(ScAddr(items[i].arg), ScAddr(items[i].other_el));
+
+    return eventObj->m_batchDelegate(ScAddr(sc_event_get_element(evt)), edges) ? SC_RESULT_OK : SC_RESULT_ERROR;
+  }
+
+  return SC_RESULT_ERROR;
+}
+
 sc_result ScEvent::HandlerDelete(sc_event const * evt)
 {
   ScEvent * eventObj = (ScEvent *)sc_event_get_data(evt);
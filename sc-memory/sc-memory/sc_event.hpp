@@ -6,12 +6,18 @@
 
 #pragma once
 
+extern "C"
+{
+#include "sc-core/sc-store/sc_event.h"
+}
+
 #include "sc_addr.hpp"
 #include "sc_utils.hpp"
 
 #include "utils/sc_lock.hpp"
 
 #include <functional>
+#include <vector>
 
 /* Base class for sc-events
  */
@@ -19,6 +25,11 @@ class ScEvent
 {
 public:
   using DelegateFunc = std::function<bool(ScAddr const &, ScAddr const &, ScAddr const &)>;
+  //! Pairs of edge and another end of edge are passed in order of emit of events
+  using BatchDelegateFunc = std::function<bool(ScAddr const &, std::vector<std::pair<ScAddr, ScAddr>> const &)>;
+
+  static constexpr uint32_t kDefaultBatchSize = 1024;
+  static constexpr uint32_t kDefaultBatchDelayMs = 10;
 
   enum class Type : uint8_t
   {
@@ -35,6 +46,17 @@ public:
       const ScAddr & addr,
       Type eventType,
       DelegateFunc func = DelegateFunc());
+
+  /* Events are collected into batches, until there are maxBatchSize of them or the first of them waits for
+   * maxDelayMs milliseconds. Batch delegate is called once for each batch
+   */
+  explicit _SC_EXTERN ScEvent(
+      class ScMemoryContext const & ctx,
+      const ScAddr & addr,
+      Type eventType,
+      BatchDelegateFunc func,
+      uint32_t maxBatchSize,
+      uint32_t maxDelayMs);
   virtual _SC_EXTERN ~ScEvent();
 
   // Don't allow copying of events
@@ -51,11 +73,13 @@ public:
 
 protected:
   static sc_result Handler(sc_event const * evt, sc_addr edge, sc_addr other_el);
+  static sc_result HandlerBatch(sc_event const * evt, sc_event_batch_item const * items, sc_uint32 count);
   static sc_result HandlerDelete(sc_event const * evt);
 
 private:
   sc_event * m_event;
   DelegateFunc m_delegate;
+  BatchDelegateFunc m_batchDelegate;
   utils::ScLock m_lock;
 };
 
@@ -70,6 +94,16 @@ public:
     : ScEvent(ctx, addr, ScEvent::Type::AddOutputEdge, func)
   {
   }
+
+  _SC_EXTERN ScEventAddOutputEdge(
+      const ScMemoryContext & ctx,
+      const ScAddr & addr,
+      ScEvent::BatchDelegateFunc func,
+      uint32_t maxBatchSize = kDefaultBatchSize,
+      uint32_t maxDelayMs = kDefaultBatchDelayMs)
+    : ScEvent(ctx, addr, ScEvent::Type::AddOutputEdge, func, maxBatchSize, maxDelayMs)
+  {
+  }
 };
 
 class ScEventAddInputEdge final : public ScEvent
@@ -81,6 +115,16 @@ public:
     : ScEvent(ctx, addr, ScEvent::Type::AddInputEdge, func)
   {
   }
+
+  _SC_EXTERN ScEventAddInputEdge(
+      const ScMemoryContext & ctx,
+      const ScAddr & addr,
+      ScEvent::BatchDelegateFunc func,
+      uint32_t maxBatchSize = kDefaultBatchSize,
+      uint32_t maxDelayMs = kDefaultBatchDelayMs)
+    : ScEvent(ctx, addr, ScEvent::Type::AddInputEdge, func, maxBatchSize, maxDelayMs)
+  {
+  }
 };
 
 class ScEventRemoveOutputEdge final : public ScEvent
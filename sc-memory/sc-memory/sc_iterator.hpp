@@ -9,6 +9,9 @@
 #include "sc_addr.hpp"
 #include "sc_utils.hpp"
 
+#include <algorithm>
+#include <array>
+
 extern "C"
 {
 #include "sc-core/sc_memory_headers.h"
@@ -16,6 +19,12 @@ extern "C"
 
 class ScMemoryContext;
 
+//! Position of 3-element iterator, that is used to resume its walk by another iterator (see sc_iterator3_seek)
+using ScIterator3Cursor = sc_iterator3_cursor;
+
+/*! Iterator, that isn't finished, delays recycling of erased sc-elements, so it shouldn't be kept alive after walk.
+ * It can be destroyed by any thread.
+ */
 template <typename IterType, sc_uint8 tripleSize>
 class TIteratorBase
 {
@@ -30,6 +39,11 @@ public:
   //! Returns false, if there are no more iterator results. It more results exists, then go to next one and returns true
   _SC_EXTERN virtual bool Next() const = 0;
 
+  /*! Goes to next results and stores up to count of them into results array at once
+   * @returns Number of stored results. If it's less than count, then there are no more results
+   */
+  _SC_EXTERN virtual size_t NextBatch(std::array<ScAddr, tripleSize> * results, size_t count) const = 0;
+
   //! Returns sc-addr of specified element in iterator result
   _SC_EXTERN virtual ScAddr Get(size_t index) const = 0;
 
@@ -93,6 +107,27 @@ public:
     return sc_iterator3_next(m_iterator) == SC_TRUE;
   }
 
+  _SC_EXTERN size_t NextBatch(ScAddrTriple * results, size_t count) const override
+  {
+    SC_ASSERT(IsValid(), ("Not valid iterator object"));
+
+    sc_addr batch[SC_ITERATOR_BATCH_SIZE * 3];
+    size_t stored = 0;
+    while (stored < count)
+    {
+      sc_uint32 const requested = (sc_uint32)std::min<size_t>(count - stored, SC_ITERATOR_BATCH_SIZE);
+      sc_uint32 const got = sc_iterator3_next_batch(m_iterator, batch, requested);
+      for (sc_uint32 i = 0; i < got; ++i)
+        results[stored + i] = {ScAddr(batch[i * 3]), ScAddr(batch[i * 3 + 1]), ScAddr(batch[i * 3 + 2])};
+
+      stored += got;
+      if (got < requested)
+        break;
+    }
+
+    return stored;
+  }
+
   _SC_EXTERN ScAddr Get(size_t index) const override
   {
     SC_ASSERT(IsValid(), ("Not valid iterator object"));
@@ -111,6 +146,31 @@ public:
     SC_ASSERT(IsValid(), ("Not valid iterator object"));
     return {Get(0), Get(1), Get(2)};
   }
+
+  /*! Makes iterator walk arcs in order of their creation. It must be called before the first Next and Seek.
+   * @returns false, if iterator doesn't walk arcs of fixed element or its walk is already started
+   */
+  _SC_EXTERN bool SetReverse() const
+  {
+    SC_ASSERT(IsValid(), ("Not valid iterator object"));
+    return sc_iterator3_set_reverse(m_iterator) == SC_RESULT_OK;
+  }
+
+  //! Gets position of iterator after the current result. Returns false, if there is no current result
+  _SC_EXTERN bool GetCursor(ScIterator3Cursor & cursor) const
+  {
+    SC_ASSERT(IsValid(), ("Not valid iterator object"));
+    return sc_iterator3_get_cursor(m_iterator, &cursor) == SC_TRUE;
+  }
+
+  /*! Continues walk after position of cursor, that was got from iterator with the same parameters.
+   * @returns false, if cursor arc was erased or iterator doesn't walk arcs of fixed element
+   */
+  _SC_EXTERN bool Seek(ScIterator3Cursor const & cursor) const
+  {
+    SC_ASSERT(IsValid(), ("Not valid iterator object"));
+    return sc_iterator3_seek(m_iterator, &cursor) == SC_RESULT_OK;
+  }
 };
 
 // ---------------------------
@@ -149,6 +209,15 @@ public:
     return sc_iterator5_next(m_iterator) == SC_TRUE;
   }
 
+  _SC_EXTERN size_t NextBatch(ScAddrFiver * results, size_t count) const override
+  {
+    size_t stored = 0;
+    while (stored < count && Next())
+      results[stored++] = Get();
+
+    return stored;
+  }
+
   _SC_EXTERN ScAddr Get(size_t index) const override
   {
     SC_ASSERT(IsValid(), ("Not valid iterator object"));
@@ -174,3 +243,315 @@ typedef TIteratorBase<sc_iterator5, 5> ScIterator5Type;
 
 typedef std::shared_ptr<ScIterator3Type> ScIterator3Ptr;
 typedef std::shared_ptr<ScIterator5Type> ScIterator5Ptr;
+
+namespace impl
+{
+inline sc_iterator3 * InitIterator(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    ScAddr const & p1,
+    sc_type p2,
+    ScAddr const & p3)
+{
+  return sc_iterator3_f_a_f_init(it, ctx, *p1, p2, *p3);
+}
+
+inline sc_iterator3 * InitIterator(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    ScAddr const & p1,
+    sc_type p2,
+    sc_type p3)
+{
+  return sc_iterator3_f_a_a_init(it, ctx, *p1, p2, p3);
+}
+
+inline sc_iterator3 * InitIterator(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type p1,
+    sc_type p2,
+    ScAddr const & p3)
+{
+  return sc_iterator3_a_a_f_init(it, ctx, p1, p2, *p3);
+}
+
+inline sc_iterator3 * InitIterator(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type p1,
+    ScAddr const & p2,
+    sc_type p3)
+{
+  return sc_iterator3_a_f_a_init(it, ctx, p1, *p2, p3);
+}
+
+inline sc_iterator3 * InitIterator(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    ScAddr const & p1,
+    ScAddr const & p2,
+    sc_type p3)
+{
+  return sc_iterator3_f_f_a_init(it, ctx, *p1, *p2, p3);
+}
+
+inline sc_iterator3 * InitIterator(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    sc_type p1,
+    ScAddr const & p2,
+    ScAddr const & p3)
+{
+  return sc_iterator3_a_f_f_init(it, ctx, p1, *p2, *p3);
+}
+
+inline sc_iterator3 * InitIterator(
+    sc_iterator3 * it,
+    sc_memory_context const * ctx,
+    ScAddr const & p1,
+    ScAddr const & p2,
+    ScAddr const & p3)
+{
+  return sc_iterator3_f_f_f_init(it, ctx, *p1, *p2, *p3);
+}
+
+inline sc_iterator5 * InitIterator(
+    sc_iterator5 * it,
+    sc_memory_context const * ctx,
+    ScAddr const & p1,
+    sc_type p2,
+    sc_type p3,
+    sc_type p4,
+    ScAddr const & p5)
+{
+  return sc_iterator5_f_a_a_a_f_init(it, ctx, *p1, p2, p3, p4, *p5);
+}
+
+inline sc_iterator5 * InitIterator(
+    sc_iterator5 * it,
+    sc_memory_context const * ctx,
+    sc_type p1,
+    sc_type p2,
+    ScAddr const & p3,
+    sc_type p4,
+    ScAddr const & p5)
+{
+  return sc_iterator5_a_a_f_a_f_init(it, ctx, p1, p2, *p3, p4, *p5);
+}
+
+inline sc_iterator5 * InitIterator(
+    sc_iterator5 * it,
+    sc_memory_context const * ctx,
+    ScAddr const & p1,
+    sc_type p2,
+    ScAddr const & p3,
+    sc_type p4,
+    ScAddr const & p5)
+{
+  return sc_iterator5_f_a_f_a_f_init(it, ctx, *p1, p2, *p3, p4, *p5);
+}
+
+inline sc_iterator5 * InitIterator(
+    sc_iterator5 * it,
+    sc_memory_context const * ctx,
+    ScAddr const & p1,
+    sc_type p2,
+    ScAddr const & p3,
+    sc_type p4,
+    sc_type p5)
+{
+  return sc_iterator5_f_a_f_a_a_init(it, ctx, *p1, p2, *p3, p4, p5);
+}
+
+inline sc_iterator5 * InitIterator(
+    sc_iterator5 * it,
+    sc_memory_context const * ctx,
+    ScAddr const & p1,
+    sc_type p2,
+    sc_type p3,
+    sc_type p4,
+    sc_type p5)
+{
+  return sc_iterator5_f_a_a_a_a_init(it, ctx, *p1, p2, p3, p4, p5);
+}
+
+inline sc_iterator5 * InitIterator(
+    sc_iterator5 * it,
+    sc_memory_context const * ctx,
+    sc_type p1,
+    sc_type p2,
+    ScAddr const & p3,
+    sc_type p4,
+    sc_type p5)
+{
+  return sc_iterator5_a_a_f_a_a_init(it, ctx, p1, p2, *p3, p4, p5);
+}
+
+inline bool NextIterator(sc_iterator3 * it)
+{
+  return sc_iterator3_next(it) == SC_TRUE;
+}
+
+inline bool NextIterator(sc_iterator5 * it)
+{
+  return sc_iterator5_next(it) == SC_TRUE;
+}
+
+inline ScAddr GetIteratorValue(sc_iterator3 * it, size_t index)
+{
+  return sc_iterator3_value(it, index);
+}
+
+inline ScAddr GetIteratorValue(sc_iterator5 * it, size_t index)
+{
+  return sc_iterator5_value(it, index);
+}
+
+template <typename FnT>
+void CallParallelWalkFn(sc_uint32 threadIndex, sc_addr const * results, sc_pointer data)
+{
+  (*static_cast<FnT *>(data))(size_t(threadIndex), ScAddr(results[0]), ScAddr(results[1]), ScAddr(results[2]));
+}
+
+template <typename FnT>
+size_t ParallelWalkIterator(sc_iterator3 * it, size_t threadsCount, FnT & fn)
+{
+  return sc_iterator3_parallel_walk(it, sc_uint32(threadsCount), CallParallelWalkFn<FnT>, &fn);
+}
+
+inline void DestroyIterator(sc_iterator3 * it)
+{
+  sc_iterator3_destroy(it);
+}
+
+inline void DestroyIterator(sc_iterator5 * it)
+{
+  sc_iterator5_destroy(it);
+}
+
+}  // namespace impl
+
+/*! Iterator, that is stored by value and doesn't allocate memory, so it is cheap to create it in nested loops.
+ * It is used in range-based for:
+ *   for (ScAddrTriple const & triple : ctx.Iterate3(addr, ScType::EdgeAccessConstPosPerm, ScType::Unknown))
+ * Results are walked once, so begin() can be called only once.
+ */
+template <typename IterType, sc_uint8 tripleSize>
+class TIteratorRange
+{
+public:
+  using ResultType = std::array<ScAddr, tripleSize>;
+
+  class Iterator
+  {
+  public:
+    explicit Iterator(TIteratorRange * range)
+      : m_range(range)
+    {
+      Advance();
+    }
+
+    ResultType operator*() const
+    {
+      return m_range->Get();
+    }
+
+    Iterator & operator++()
+    {
+      Advance();
+      return *this;
+    }
+
+    bool operator!=(Iterator const & other) const
+    {
+      return m_range != other.m_range;
+    }
+
+  private:
+    void Advance()
+    {
+      if (m_range != nullptr && !m_range->Next())
+        m_range = nullptr;
+    }
+
+    TIteratorRange * m_range;
+  };
+
+  template <typename... ParamTypes>
+  TIteratorRange(sc_memory_context const * ctx, ParamTypes const &... params)
+    : m_iterator(impl::InitIterator(&m_storage, ctx, params...))
+  {
+  }
+
+  // iterator points to its storage, so it can't be copied or moved
+  TIteratorRange(TIteratorRange const & other) = delete;
+  TIteratorRange & operator=(TIteratorRange const & other) = delete;
+
+  ~TIteratorRange()
+  {
+    if (m_iterator != nullptr)
+      impl::DestroyIterator(m_iterator);
+  }
+
+  inline bool IsValid() const
+  {
+    return m_iterator != nullptr;
+  }
+
+  //! Returns false, if there are no more iterator results. It more results exists, then go to next one and returns true
+  bool Next()
+  {
+    SC_ASSERT(IsValid(), ("Not valid iterator object"));
+    return impl::NextIterator(m_iterator);
+  }
+
+  //! Returns sc-addr of specified element in iterator result
+  ScAddr Get(size_t index) const
+  {
+    SC_ASSERT(IsValid(), ("Not valid iterator object"));
+    if (index < tripleSize)
+      return impl::GetIteratorValue(m_iterator, index);
+
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Index=" + std::to_string(index) + " must be < size=" + std::to_string(tripleSize));
+  }
+
+  //! Returns all sc-addrs of iterator result
+  ResultType Get() const
+  {
+    ResultType result;
+    for (size_t i = 0; i < tripleSize; ++i)
+      result[i] = Get(i);
+    return result;
+  }
+
+  /*! Walks all remaining results by several threads and calls fn(threadIndex, source, edge, target) for each of them.
+   * Calls with different threadIndex are concurrent. It's available for 3-element iterators only.
+   * @returns Number of walked results
+   */
+  template <typename FnT>
+  size_t ParallelForEach(FnT && fn, size_t threadsCount = 0)
+  {
+    SC_ASSERT(IsValid(), ("Not valid iterator object"));
+    return impl::ParallelWalkIterator(m_iterator, threadsCount, fn);
+  }
+
+  Iterator begin()
+  {
+    return Iterator(this);
+  }
+
+  Iterator end()
+  {
+    return Iterator(nullptr);
+  }
+
+private:
+  IterType m_storage;
+  IterType * m_iterator;
+};
+
+using ScIterator3Range = TIteratorRange<sc_iterator3, 3>;
+using ScIterator5Range = TIteratorRange<sc_iterator5, 5>;
@@ -246,12 +246,35 @@ size_t ScMemoryContext::GetElementInputArcsCount(ScAddr const & addr) const
   return sc_memory_get_element_input_arcs_count(m_context, *addr);
 }
 
+size_t ScMemoryContext::GetElementOutputArcsCount(ScAddr const & addr, ScType const & arcType) const
+{
+  CHECK_CONTEXT;
+  return sc_memory_get_element_output_arcs_count_by_type(m_context, *addr, *arcType);
+}
+
+size_t ScMemoryContext::GetElementInputArcsCount(ScAddr const & addr, ScType const & arcType) const
+{
+  CHECK_CONTEXT;
+  return sc_memory_get_element_input_arcs_count_by_type(m_context, *addr, *arcType);
+}
+
 bool ScMemoryContext::EraseElement(ScAddr const & addr)
 {
   CHECK_CONTEXT;
   return sc_memory_element_free(m_context, *addr) == SC_RESULT_OK;
 }
 
+bool ScMemoryContext::EraseElements(ScAddrVector const & addrs)
+{
+  CHECK_CONTEXT;
+  std::vector<sc_addr> elements;
+  elements.reserve(addrs.size());
+  for (ScAddr const & addr : addrs)
+    elements.push_back(*addr);
+
+  return sc_memory_elements_free_batch(m_context, elements.data(), (sc_uint32)elements.size()) == SC_RESULT_OK;
+}
+
 ScAddr ScMemoryContext::CreateNode(ScType const & type)
 {
   CHECK_CONTEXT;
@@ -285,6 +308,63 @@ ScAddr ScMemoryContext::CreateEdge(ScType const & type, ScAddr const & addrBeg,
   return sc_memory_arc_new(m_context, *type, *addrBeg, *addrEnd);
 }
 
+ScAddrVector ScMemoryContext::CreateNodes(std::vector<ScType> const & types)
+{
+  CHECK_CONTEXT;
+  std::vector<sc_type> nodeTypes;
+  nodeTypes.reserve(types.size());
+  for (ScType const & type : types)
+  {
+    if (type.IsEdge())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "Specified types must be sc-node types. You should provide any of ScType::Node... values as types");
+
+    nodeTypes.push_back(*type);
+  }
+
+  std::vector<sc_addr> result(types.size());
+  sc_memory_nodes_new_batch(m_context, nodeTypes.data(), (sc_uint32)nodeTypes.size(), result.data());
+
+  return ScAddrVector(result.cbegin(), result.cend());
+}
+
+ScAddrVector ScMemoryContext::CreateEdges(
+    std::vector<ScType> const & types,
+    ScAddrVector const & addrsBeg,
+    ScAddrVector const & addrsEnd)
+{
+  CHECK_CONTEXT;
+  if (types.size() != addrsBeg.size() || types.size() != addrsEnd.size())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Specified types, begin and end elements must have the same count");
+
+  std::vector<sc_type> edgeTypes;
+  std::vector<sc_addr> begins;
+  std::vector<sc_addr> ends;
+  edgeTypes.reserve(types.size());
+  begins.reserve(types.size());
+  ends.reserve(types.size());
+  for (size_t i = 0; i < types.size(); ++i)
+  {
+    if (!types[i].IsEdge())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "Specified types must be sc-connector types. You should provide any of ScType::Edge... values as types");
+
+    edgeTypes.push_back(*types[i]);
+    begins.push_back(*addrsBeg[i]);
+    ends.push_back(*addrsEnd[i]);
+  }
+
+  std::vector<sc_addr> result(types.size());
+  sc_memory_arcs_new_batch(
+      m_context, edgeTypes.data(), begins.data(), ends.data(), (sc_uint32)edgeTypes.size(), result.data());
+
+  return ScAddrVector(result.cbegin(), result.cend());
+}
+
 ScType ScMemoryContext::GetElementType(ScAddr const & addr) const
 {
   CHECK_CONTEXT;
@@ -118,14 +118,37 @@ public:
   //! Returns count of element input arcs
   _SC_EXTERN size_t GetElementInputArcsCount(ScAddr const & addr) const;
 
+  /*! Returns upper bound of count of element output arcs with specified type. It's read without locks and walk of arcs,
+   * so it's cheap to use it to estimate selectivity of arc types (see sc_storage_get_element_output_arcs_count_by_type)
+   */
+  _SC_EXTERN size_t GetElementOutputArcsCount(ScAddr const & addr, ScType const & arcType) const;
+  //! Returns upper bound of count of element input arcs with specified type
+  _SC_EXTERN size_t GetElementInputArcsCount(ScAddr const & addr, ScType const & arcType) const;
+
   //! Erase element from sc-memory and returns true on success; otherwise returns false.
   _SC_EXTERN bool EraseElement(ScAddr const & addr);
 
+  /*! Erases elements from sc-memory at once and returns true on success; otherwise returns false and nothing is erased.
+   * Elements, that don't exist, are skipped.
+   */
+  _SC_EXTERN bool EraseElements(ScAddrVector const & addrs);
+
   _SC_EXTERN ScAddr CreateNode(ScType const & type);
   _SC_EXTERN ScAddr CreateLink(ScType const & type = ScType::LinkConst);
 
   _SC_EXTERN ScAddr CreateEdge(ScType const & type, ScAddr const & addrBeg, ScAddr const & addrEnd);
 
+  //! Creates sc-nodes with specified types at once. Returns their addrs in the same order
+  _SC_EXTERN ScAddrVector CreateNodes(std::vector<ScType> const & types);
+
+  /*! Creates sc-edges with specified types, begin and end elements at once. All vectors must have the same size.
+   * Returns addrs of created edges in the same order. If edge wasn't created, then its addr is invalid.
+   */
+  _SC_EXTERN ScAddrVector CreateEdges(
+      std::vector<ScType> const & types,
+      ScAddrVector const & addrsBeg,
+      ScAddrVector const & addrsEnd);
+
   //! Returns type of sc-element. If there are any error, then returns ScType::Unknown
   _SC_EXTERN ScType GetElementType(ScAddr const & addr) const;
 
@@ -219,15 +242,58 @@ public:
         new TIterator3<ParamType1, ParamType2, ParamType3>(*this, param1, param2, param3));
   }
 
+  /*! Creates iterator by value, that doesn't allocate memory. It's used in range-based for:
+   *   for (ScAddrTriple const & triple : ctx.Iterate3(addr, ScType::EdgeAccessConstPosPerm, ScType::Unknown))
+   */
+  template <typename ParamType1, typename ParamType2, typename ParamType3>
+  ScIterator3Range Iterate3(ParamType1 const & param1, ParamType2 const & param2, ParamType3 const & param3) const
+  {
+    return ScIterator3Range(m_context, param1, param2, param3);
+  }
+
+  //! Creates iterator of 5-element constructions by value, that doesn't allocate memory (see Iterate3)
+  template <typename ParamType1, typename ParamType2, typename ParamType3, typename ParamType4, typename ParamType5>
+  ScIterator5Range Iterate5(
+      ParamType1 const & param1,
+      ParamType2 const & param2,
+      ParamType3 const & param3,
+      ParamType4 const & param4,
+      ParamType5 const & param5) const
+  {
+    return ScIterator5Range(m_context, param1, param2, param3, param4, param5);
+  }
+
   /* Make iteration by triples, and call fn function for each result.
    * fn function should have 3 parameters (ScAddr const & source, ScAddr const & edge, ScAddr const & target)
    */
   template <typename ParamType1, typename ParamType2, typename ParamType3, typename FnT>
   void ForEachIter3(ParamType1 const & param1, ParamType2 const & param2, ParamType3 const & param3, FnT && fn)
   {
-    ScIterator3Ptr it = Iterator3(param1, param2, param3);
-    while (it->Next())
-      fn(it->Get(0), it->Get(1), it->Get(2));
+    ScIterator3Range it = Iterate3(param1, param2, param3);
+    while (it.Next())
+      fn(it.Get(0), it.Get(1), it.Get(2));
+  }
+
+  /* Make iteration by triples in several threads, and call fn function for each result.
+   * fn function should have 4 parameters
+   * (size_t threadIndex, ScAddr const & source, ScAddr const & edge, ScAddr const & target).
+   * It's called concurrently by threads with different threadIndex from [0, threadsCount). Arcs of fixed element are
+   * walked in parallel for iterators with one fixed element only. If threadsCount is 0, then number of processors is
+   * used. Returns number of walked triples.
+   */
+  template <typename ParamType1, typename ParamType2, typename ParamType3, typename FnT>
+  size_t ParallelForEachIter3(
+      ParamType1 const & param1,
+      ParamType2 const & param2,
+      ParamType3 const & param3,
+      FnT && fn,
+      size_t threadsCount = 0)
+  {
+    ScIterator3Range it = Iterate3(param1, param2, param3);
+    if (!it.IsValid())
+      return 0;
+
+    return it.ParallelForEach(fn, threadsCount);
   }
 
   /* Make iteration by 5-element constructions, and call fn function for each result.
@@ -249,9 +315,9 @@ public:
       ParamType5 const & param5,
       FnT && fn)
   {
-    ScIterator5Ptr it = Iterator5(param1, param2, param3, param4, param5);
-    while (it->Next())
-      fn(it->Get(0), it->Get(1), it->Get(2), it->Get(3), it->Get(4));
+    ScIterator5Range it = Iterate5(param1, param2, param3, param4, param5);
+    while (it.Next())
+      fn(it.Get(0), it.Get(1), it.Get(2), it.Get(3), it.Get(4));
   }
 
   /*! Tries to resolve ScAddr by it system identifier. If element with specified identifier doesn't exist
@@ -342,6 +342,13 @@ private:
     }
   }
 
+  //! Returns type of triple arcs, so only arcs of this type are counted to find the most selective triple
+  static ScType GetTripleArcType(ScTemplateTriple const * triple)
+  {
+    ScTemplateItem const & arcItem = triple->GetValues()[1];
+    return arcItem.IsType() ? arcItem.m_typeValue : ScType::Unknown;
+  }
+
   sc_int32 FindTripleWithMostMinimalInputArcsForThirdItem(ScTemplateTriples const & connectivityComponentsTriples)
   {
     auto triplesWithConstEndElement = m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplateTripleType::FAF];
@@ -360,7 +367,8 @@ private:
         continue;
 
       ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
-      auto const count = (sc_int32)m_context.GetElementInputArcsCount(triple->GetValues()[2].m_addrValue);
+      auto const count = (sc_int32)m_context.GetElementInputArcsCount(
+          triple->GetValues()[2].m_addrValue, GetTripleArcType(triple));
 
       if (minInputArcsCount == -1 || count < minInputArcsCount)
       {
@@ -389,7 +397,8 @@ private:
         continue;
 
       ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
-      auto const count = (sc_int32)m_context.GetElementOutputArcsCount(triple->GetValues()[0].m_addrValue);
+      auto const count = (sc_int32)m_context.GetElementOutputArcsCount(
+          triple->GetValues()[0].m_addrValue, GetTripleArcType(triple));
 
       if (minOutputArcsCount == -1 || count < minOutputArcsCount)
       {
@@ -9,7 +9,12 @@
 #include "units/memory_create_edge.hpp"
 #include "units/memory_create_node.hpp"
 #include "units/memory_create_link.hpp"
+#include "units/memory_contention.hpp"
+#include "units/memory_create_batch.hpp"
+#include "units/memory_events.hpp"
+#include "units/memory_iterate_edges.hpp"
 #include "units/memory_remove_elements.hpp"
+#include "units/memory_scaling.hpp"
 
 #include "units/sc_code_base_vs_extend.hpp"
 
@@ -132,6 +137,50 @@ BENCHMARK_TEMPLATE(BM_MemoryThreaded, TestCreateSameLink)
 ->Iterations(kLinkIters / 128)
 ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+// compare throughput and CPU time of waiting for section locks, when there are more threads than cores
+int constexpr kContendedIters = 200000;
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded, TestContendedNodes)
+->Threads(OversubscribedThreads(1))
+->Iterations(kContendedIters / OversubscribedThreads(1))
+->MeasureProcessCPUTime()
+->UseRealTime()
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded, TestContendedNodes)
+->Threads(OversubscribedThreads(2))
+->Iterations(kContendedIters / OversubscribedThreads(2))
+->MeasureProcessCPUTime()
+->UseRealTime()
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+// scaling with number of segment sections (concurrency_level) on many threads
+int constexpr kScalingIters = 1000000;
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded, TestScalingEdges<32>)
+->Threads(64)
+->Iterations(kScalingIters / 64)
+->UseRealTime()
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded, TestScalingEdges<256>)
+->Threads(64)
+->Iterations(kScalingIters / 64)
+->UseRealTime()
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded, TestScalingEdges<32>)
+->Threads(128)
+->Iterations(kScalingIters / 128)
+->UseRealTime()
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded, TestScalingEdges<256>)
+->Threads(128)
+->Iterations(kScalingIters / 128)
+->UseRealTime()
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
 
 // ------------------------------------
 template <class BMType>
@@ -175,11 +224,85 @@ BENCHMARK_TEMPLATE(BM_MemoryRanged, TestCreateEdge)
 ->Arg(1000)
 ->Iterations(5000000);
 
+// compare loading of triples one element at a time and with batch calls
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestLoadTriples<false>)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(100)->Arg(1000)->Arg(10000)
+->Iterations(100);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestLoadTriples<true>)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(100)->Arg(1000)->Arg(10000)
+->Iterations(100);
+
 BENCHMARK_TEMPLATE(BM_MemoryRanged, TestRemoveElements)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(10)->Arg(100)->Arg(1000)
 ->Iterations(5000);
 
+template <class BMType>
+void BM_MemoryPrepared(benchmark::State & state)
+{
+  BMType test;
+  test.Initialize(state.range(0));
+  uint32_t iterations = 0;
+  for (auto t : state)
+  {
+    state.PauseTiming();
+    test.Prepare();
+    state.ResumeTiming();
+
+    test.Run();
+    ++iterations;
+  }
+  state.counters["rate"] = benchmark::Counter(iterations, benchmark::Counter::kIsRate);
+  test.Shutdown();
+}
+
+BENCHMARK_TEMPLATE(BM_MemoryPrepared, TestRemoveHub)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000)->Arg(10000)->Arg(100000)
+->Iterations(10);
+
+// build with SC_SEGMENT_COLUMNS to compare traversal over segment columns
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestIterateOutputEdges)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000)->Arg(10000)->Arg(100000);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestIterateInputEdges)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000)->Arg(10000)->Arg(100000);
+
+// walk of 1M-degree node by one thread and in parallel
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestIterateOutputEdges)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000000)->Iterations(20);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestIterateOutputEdgesParallel<1>)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000000)->Iterations(20);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestIterateOutputEdgesParallel<4>)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000000)->Iterations(20);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestIterateOutputEdgesParallel<8>)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000000)->Iterations(20);
+
+// throughput of events dispatcher: 10000 calls per iteration are spread over Arg subscriptions
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEventsDispatch<false>)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1)->Arg(100)->Arg(10000)
+->Iterations(20)
+->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEventsDispatch<true>)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1)->Arg(100)->Arg(10000)
+->Iterations(20)
+->UseRealTime();
+
 // ------------------------------------
 template <class BMType>
 void BM_Template(benchmark::State & state)
@@ -0,0 +1,46 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include <thread>
+
+// All threads append edges to a few shared nodes and read them back, so they wait for each other on the same
+// segment sections
+class TestContendedNodes : public TestMemory
+{
+public:
+  void Run()
+  {
+    ScAddr const & hub = s_hubs[random() % s_hubs.size()];
+    ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, hub, node);
+
+    m_ctx->GetElementType(hub);
+    m_ctx->IsElement(node);
+  }
+
+  void Setup(size_t) override
+  {
+    s_hubs.clear();
+    for (size_t i = 0; i < kHubsNum; ++i)
+      s_hubs.push_back(m_ctx->CreateNode(ScType::NodeConst));
+  }
+
+  static size_t constexpr kHubsNum = 4;
+
+private:
+  static inline ScAddrVector s_hubs;
+};
+
+//! Returns number of threads, that oversubscribes available cores in specified number of times
+inline int OversubscribedThreads(unsigned factor)
+{
+  unsigned const cores = std::thread::hardware_concurrency();
+  return static_cast<int>((cores == 0 ? 1 : cores) * factor);
+}
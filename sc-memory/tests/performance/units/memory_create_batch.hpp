@@ -0,0 +1,44 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+// Each run loads specified number of triples "set -> node", one element at a time or with batch calls
+template <bool kUseBatch>
+class TestLoadTriples : public TestMemory
+{
+public:
+  void Run()
+  {
+    if (kUseBatch)
+    {
+      ScAddrVector const nodes = m_ctx->CreateNodes(m_nodeTypes);
+      m_ctx->CreateEdges(m_edgeTypes, m_sets, nodes);
+    }
+    else
+    {
+      for (size_t i = 0; i < m_sets.size(); ++i)
+      {
+        ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+        m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_sets[i], node);
+      }
+    }
+  }
+
+  void Setup(size_t triplesNum) override
+  {
+    m_nodeTypes.assign(triplesNum, ScType::NodeConst);
+    m_edgeTypes.assign(triplesNum, ScType::EdgeAccessConstPosPerm);
+    m_sets.assign(triplesNum, m_ctx->CreateNode(ScType::NodeConst));
+  }
+
+private:
+  std::vector<ScType> m_nodeTypes;
+  std::vector<ScType> m_edgeTypes;
+  ScAddrVector m_sets;
+};
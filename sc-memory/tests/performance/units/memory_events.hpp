@@ -0,0 +1,69 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include "sc-memory/sc_event.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+//! Emits calls of sc-events, that are spread over subscriptions, and waits until all of them are processed
+template <bool kOrderedDelivery>
+class TestEventsDispatch : public TestMemory
+{
+public:
+  static size_t constexpr kCallsPerRun = 10000;
+
+  void InitParams(sc_memory_params & params) override
+  {
+    params.ordered_events_delivery = kOrderedDelivery ? SC_TRUE : SC_FALSE;
+  }
+
+  void Setup(size_t subscriptionsNum) override
+  {
+    m_target = m_ctx->CreateNode(ScType::NodeConst);
+    for (size_t i = 0; i < subscriptionsNum; ++i)
+    {
+      ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+      m_nodes.push_back(node);
+      m_events.emplace_back(new ScEventAddOutputEdge(
+          *m_ctx,
+          node,
+          [this](ScAddr const &, ScAddr const &, ScAddr const &)
+          {
+            ++m_callsCount;
+            return true;
+          }));
+    }
+  }
+
+  void Run()
+  {
+    for (size_t i = 0; i < kCallsPerRun; ++i)
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_nodes[i % m_nodes.size()], m_target);
+
+    m_emittedCount += kCallsPerRun;
+    while (m_callsCount.load() < m_emittedCount)
+      std::this_thread::yield();
+  }
+
+  void Shutdown()
+  {
+    m_events.clear();
+    TestMemory::Shutdown();
+  }
+
+private:
+  ScAddr m_target;
+  std::vector<ScAddr> m_nodes;
+  std::vector<std::unique_ptr<ScEventAddOutputEdge>> m_events;
+  std::atomic<size_t> m_callsCount = {0};
+  size_t m_emittedCount = 0;
+};
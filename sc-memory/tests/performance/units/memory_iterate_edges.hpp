@@ -0,0 +1,88 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include <array>
+
+class TestIterateEdges : public TestMemory
+{
+public:
+  void Setup(size_t elementsNum) override
+  {
+    m_node = m_ctx->CreateNode(ScType::NodeConst);
+    for (size_t i = 0; i < elementsNum; ++i)
+    {
+      ScAddr const trg = m_ctx->CreateNode(ScType::NodeConst);
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_node, trg);
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, trg, m_node);
+
+      // spread arcs of large fan-out node over segment
+      ScAddr const noise = m_ctx->CreateNode(ScType::NodeConst);
+      m_ctx->CreateEdge(ScType::EdgeDCommonConst, noise, trg);
+    }
+    m_count = elementsNum;
+  }
+
+protected:
+  ScAddr m_node;
+  size_t m_count = 0;
+};
+
+class TestIterateOutputEdges : public TestIterateEdges
+{
+public:
+  void Run()
+  {
+    size_t count = 0;
+    ScIterator3Ptr const it = m_ctx->Iterator3(m_node, ScType::EdgeAccessConstPosPerm, ScType::NodeConst);
+    while (it->Next())
+      ++count;
+
+    BENCHMARK_BUILTIN_EXPECT(count, m_count);
+  }
+};
+
+class TestIterateInputEdges : public TestIterateEdges
+{
+public:
+  void Run()
+  {
+    size_t count = 0;
+    ScIterator3Ptr const it = m_ctx->Iterator3(ScType::NodeConst, ScType::EdgeAccessConstPosPerm, m_node);
+    while (it->Next())
+      ++count;
+
+    BENCHMARK_BUILTIN_EXPECT(count, m_count);
+  }
+};
+
+//! Walks output arcs of node by kThreadsCount threads, each of them counts its results separately
+template <size_t kThreadsCount>
+class TestIterateOutputEdgesParallel : public TestIterateEdges
+{
+public:
+  void Run()
+  {
+    std::array<size_t, kThreadsCount> counts{};
+    m_ctx->ParallelForEachIter3(
+        m_node,
+        ScType::EdgeAccessConstPosPerm,
+        ScType::NodeConst,
+        [&counts](size_t threadIndex, ScAddr const &, ScAddr const &, ScAddr const &) {
+          ++counts[threadIndex];
+        },
+        kThreadsCount);
+
+    size_t count = 0;
+    for (size_t const threadCount : counts)
+      count += threadCount;
+
+    BENCHMARK_BUILTIN_EXPECT(count, m_count);
+  }
+};
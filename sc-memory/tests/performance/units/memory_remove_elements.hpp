@@ -38,3 +38,33 @@ public:
 private:
   ScAddr m_addr;
 };
+
+// Removes node with many incident edges, so deletion cascades through long lists of connectors
+class TestRemoveHub : public TestMemory
+{
+public:
+  void Run()
+  {
+    m_ctx->EraseElement(m_hub);
+  }
+
+  // creates new hub before each run, as previous one is removed by it
+  void Prepare()
+  {
+    m_hub = m_ctx->CreateNode(ScType::NodeConst);
+    for (size_t i = 0; i < m_degree; ++i)
+    {
+      ScAddr const trg = m_ctx->CreateNode(ScType::NodeConst);
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_hub, trg);
+    }
+  }
+
+  void Setup(size_t objectsNum) override
+  {
+    m_degree = objectsNum;
+  }
+
+private:
+  ScAddr m_hub;
+  size_t m_degree = 0;
+};
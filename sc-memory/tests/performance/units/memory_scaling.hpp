@@ -0,0 +1,33 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+// Each thread appends edges to its own node, so threads meet only on segment sections
+template <sc_uint32 kConcurrencyLevel>
+class TestScalingEdges : public TestMemory
+{
+public:
+  void InitParams(sc_memory_params & params) override
+  {
+    params.concurrency_level = kConcurrencyLevel;
+  }
+
+  void Run()
+  {
+    if (!m_node.IsValid())
+      m_node = m_ctx->CreateNode(ScType::NodeConst);
+
+    ScAddr const trg = m_ctx->CreateNode(ScType::NodeConst);
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_node, trg);
+    m_ctx->GetElementType(trg);
+  }
+
+private:
+  ScAddr m_node;
+};
@@ -19,6 +19,7 @@ public:
     sc_memory_params_clear(&params);
     params.clear = SC_TRUE;
     params.repo_path = "test_repo";
+    InitParams(params);
 
     ScMemory::LogMute();
     ScMemory::Initialize(params);
@@ -49,6 +50,8 @@ public:
     return static_cast<bool>(m_ctx);
   }
 
+  virtual void InitParams(sc_memory_params & params) {}
+
   virtual void Setup(size_t objectsNum) {}
 
 protected:
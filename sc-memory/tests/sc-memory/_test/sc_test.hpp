@@ -21,7 +21,10 @@ protected:
     ScMemoryTest::Shutdown();
   }
 
-  void Initialize(sc_uint32 max_events_and_agents_threads = DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS, std::string const & result_structure = "")
+  void Initialize(
+      sc_uint32 max_events_and_agents_threads = DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS,
+      std::string const & result_structure = "",
+      sc_bool ordered_events_delivery = DEFAULT_ORDERED_EVENTS_DELIVERY)
   {
     sc_memory_params params;
     sc_memory_params_clear(&params);
@@ -31,6 +34,7 @@ protected:
     params.log_level = "Debug";
 
     params.max_events_and_agents_threads = max_events_and_agents_threads;
+    params.ordered_events_delivery = ordered_events_delivery;
 
     params.init_memory_generated_upload = !result_structure.empty();
     params.init_memory_generated_structure = result_structure.c_str();
@@ -68,3 +72,12 @@ class ScSingleThreadedMemoryTest : public ScMemoryTest
     m_ctx = std::make_unique<ScMemoryContext>(sc_access_lvl_make_min, "test");
   }
 };
+
+class ScOrderedEventsMemoryTest : public ScMemoryTest
+{
+  virtual void SetUp()
+  {
+    ScOrderedEventsMemoryTest::Initialize(DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS, "", SC_TRUE);
+    m_ctx = std::make_unique<ScMemoryContext>(sc_access_lvl_make_min, "test");
+  }
+};
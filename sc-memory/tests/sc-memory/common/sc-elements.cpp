@@ -4,6 +4,8 @@
 
 #include "sc_test.hpp"
 
+#include <thread>
+
 
 TEST_F(ScMemoryTest, elements)
 {
@@ -125,3 +127,176 @@ TEST_F(ScMemoryTest, CreateDeleteCountEdges2)
   EXPECT_EQ(ctx.GetElementOutputArcsCount(relation), 0u);
   EXPECT_EQ(ctx.GetElementInputArcsCount(relation), 0u);
 }
+
+TEST_F(ScMemoryTest, CountEdgesByType)
+{
+  ScMemoryContext ctx(sc_access_lvl_make_min, "CountEdgesByType");
+
+  ScAddr const node = ctx.CreateNode(ScType::NodeConst);
+  ScAddr const other = ctx.CreateNode(ScType::NodeConst);
+  for (size_t i = 0; i < 3; ++i)
+    ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, node, other);
+  ScAddr const commonEdge = ctx.CreateEdge(ScType::EdgeDCommonConst, node, other);
+
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(node, ScType::Unknown), 4u);
+  EXPECT_EQ(ctx.GetElementInputArcsCount(other, ScType::Unknown), 4u);
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(node, ScType::Const), 4u);
+
+#ifdef SC_ARC_TYPE_INDEX
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(node, ScType::EdgeAccessConstPosPerm), 3u);
+  EXPECT_EQ(ctx.GetElementInputArcsCount(other, ScType::EdgeAccess), 3u);
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(node, ScType::EdgeDCommonConst), 1u);
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(node, ScType::EdgeUCommon), 0u);
+#else
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(node, ScType::EdgeAccessConstPosPerm), 4u);
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(node, ScType::EdgeUCommon), 4u);
+#endif
+
+  EXPECT_TRUE(ctx.EraseElement(commonEdge));
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(node, ScType::EdgeAccessConstPosPerm), 3u);
+  EXPECT_EQ(ctx.GetElementInputArcsCount(other, ScType::EdgeAccessConstPosPerm), 3u);
+
+  EXPECT_TRUE(ctx.EraseElement(node));
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(node, ScType::EdgeAccessConstPosPerm), 0u);
+  EXPECT_EQ(ctx.GetElementInputArcsCount(other, ScType::EdgeAccessConstPosPerm), 0u);
+}
+
+TEST_F(ScMemoryTest, CreateElementsBatch)
+{
+  ScMemoryContext ctx(sc_access_lvl_make_min, "CreateElementsBatch");
+
+  size_t const count = 1000;
+  std::vector<ScType> const nodeTypes(count, ScType::NodeConst);
+  ScAddrVector const nodes = ctx.CreateNodes(nodeTypes);
+  EXPECT_EQ(nodes.size(), count);
+
+  ScAddr const set = ctx.CreateNode(ScType::NodeConst);
+  ScAddrVector const sets(count, set);
+  std::vector<ScType> const edgeTypes(count, ScType::EdgeAccessConstPosPerm);
+  ScAddrVector const edges = ctx.CreateEdges(edgeTypes, sets, nodes);
+  EXPECT_EQ(edges.size(), count);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    EXPECT_EQ(ctx.GetElementType(nodes[i]), ScType::NodeConst);
+    EXPECT_EQ(ctx.GetElementType(edges[i]), ScType::EdgeAccessConstPosPerm);
+    EXPECT_EQ(ctx.GetEdgeSource(edges[i]), set);
+    EXPECT_EQ(ctx.GetEdgeTarget(edges[i]), nodes[i]);
+  }
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(set), count);
+
+  EXPECT_TRUE(ctx.EraseElement(nodes[0]));
+  ScAddrVector const invalidEdges = ctx.CreateEdges(
+      {ScType::EdgeAccessConstPosPerm, ScType::EdgeAccessConstPosPerm}, {set, set}, {nodes[0], nodes[1]});
+  EXPECT_FALSE(invalidEdges[0].IsValid());
+  EXPECT_TRUE(invalidEdges[1].IsValid());
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(set), count);
+
+  EXPECT_THROW(ctx.CreateNodes({ScType::EdgeAccessConstPosPerm}), utils::ExceptionInvalidParams);
+  EXPECT_THROW(ctx.CreateEdges({ScType::NodeConst}, {set}, {nodes[1]}), utils::ExceptionInvalidParams);
+  EXPECT_THROW(ctx.CreateEdges(edgeTypes, {set}, {nodes[1]}), utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScMemoryTest, EraseElementsBatch)
+{
+  ScMemoryContext ctx(sc_access_lvl_make_min, "EraseElementsBatch");
+
+  ScAddr const set = ctx.CreateNode(ScType::NodeConst);
+  ScAddr const other = ctx.CreateNode(ScType::NodeConst);
+  ScAddrVector nodes;
+  ScAddrVector edges;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    nodes.push_back(ctx.CreateNode(ScType::NodeConst));
+    edges.push_back(ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, set, nodes.back()));
+    // edge between two erased edges
+    if (i > 0)
+      ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, edges[i - 1], edges[i]);
+  }
+  ScAddr const otherEdge = ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, other, set);
+
+  ScAddrVector erased = edges;
+  erased.insert(erased.end(), nodes.cbegin(), nodes.cbegin() + 50);
+  erased.push_back(edges[0]);
+  erased.push_back(ScAddr::Empty);
+  EXPECT_TRUE(ctx.EraseElements(erased));
+
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    EXPECT_FALSE(ctx.IsElement(edges[i]));
+    EXPECT_EQ(ctx.IsElement(nodes[i]), i >= 50);
+  }
+  EXPECT_EQ(ctx.GetElementOutputArcsCount(set), 0u);
+  EXPECT_TRUE(ctx.IsElement(otherEdge));
+
+  EXPECT_TRUE(ctx.EraseElements({set, other}));
+  EXPECT_FALSE(ctx.IsElement(otherEdge));
+  EXPECT_TRUE(ctx.EraseElements({}));
+}
+
+TEST_F(ScMemoryTest, EraseElementsInThreadsWithOneContext)
+{
+  ScMemoryContext ctx(sc_access_lvl_make_min, "EraseElementsInThreadsWithOneContext");
+
+  size_t const threadsCount = 4;
+  size_t const setsCount = 200;
+  std::vector<ScAddrVector> sets(threadsCount);
+  std::vector<ScAddrVector> elements(threadsCount);
+  for (size_t t = 0; t < threadsCount; ++t)
+  {
+    for (size_t i = 0; i < setsCount; ++i)
+    {
+      ScAddr const set = ctx.CreateNode(ScType::NodeConst);
+      ScAddr const node = ctx.CreateNode(ScType::NodeConst);
+      sets[t].push_back(set);
+      elements[t].push_back(node);
+      elements[t].push_back(ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, set, node));
+    }
+  }
+
+  // deletions in different threads with the same context don't share their buffers
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < threadsCount; ++t)
+  {
+    threads.emplace_back(
+        [&ctx, &sets, t]()
+        {
+          for (ScAddr const & set : sets[t])
+            EXPECT_TRUE(ctx.EraseElement(set));
+        });
+  }
+  for (auto & thread : threads)
+    thread.join();
+
+  for (size_t t = 0; t < threadsCount; ++t)
+  {
+    for (size_t i = 0; i < elements[t].size(); ++i)
+      EXPECT_EQ(ctx.IsElement(elements[t][i]), i % 2 == 0);
+  }
+}
+
+TEST_F(ScMemoryTest, CheckEdges)
+{
+  ScMemoryContext ctx(sc_access_lvl_make_min, "CheckEdges");
+
+  ScAddr const set = ctx.CreateNode(ScType::NodeConst);
+  ScAddr const node = ctx.CreateNode(ScType::NodeConst);
+  ScAddr const edge = ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, set, node);
+  ScAddr const relationEdge = ctx.CreateEdge(ScType::EdgeDCommonConst, set, node);
+  for (size_t i = 0; i < 100; ++i)
+    ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, ctx.CreateNode(ScType::NodeConst), node);
+
+  EXPECT_TRUE(ctx.HelperCheckEdge(set, node, ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(ctx.HelperCheckEdge(set, node, ScType::EdgeAccess));
+  EXPECT_TRUE(ctx.HelperCheckEdge(set, node, ScType::EdgeDCommonConst));
+  EXPECT_FALSE(ctx.HelperCheckEdge(set, node, ScType::EdgeAccessConstNegPerm));
+  EXPECT_FALSE(ctx.HelperCheckEdge(node, set, ScType::EdgeAccessConstPosPerm));
+
+  EXPECT_TRUE(ctx.EraseElement(edge));
+  EXPECT_FALSE(ctx.HelperCheckEdge(set, node, ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(ctx.HelperCheckEdge(set, node, ScType::EdgeDCommonConst));
+
+  EXPECT_TRUE(ctx.EraseElement(set));
+  EXPECT_FALSE(ctx.IsElement(relationEdge));
+  EXPECT_FALSE(ctx.HelperCheckEdge(set, node, ScType::EdgeDCommonConst));
+}
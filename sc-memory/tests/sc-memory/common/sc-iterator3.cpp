@@ -63,6 +63,252 @@ TEST_F(ScIterator3Test, f_a_a)
   EXPECT_EQ(iter3->Get(2), m_target);
 }
 
+TEST_F(ScIterator3Test, ArcTypes)
+{
+  ScAddr const relationEdge = m_ctx->CreateEdge(ScType::EdgeDCommonConst, m_source, m_target);
+  ScAddrVector edges;
+  for (size_t i = 0; i < 10; ++i)
+    edges.push_back(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_source, m_ctx->CreateNode(ScType::NodeConst)));
+
+  auto const countOutput = [this](ScType const & edgeType) {
+    size_t count = 0;
+    ScIterator3Ptr const iter3 = m_ctx->Iterator3(m_source, edgeType, ScType::Unknown);
+    while (iter3->Next())
+      ++count;
+    return count;
+  };
+
+  auto const countInput = [this](ScType const & edgeType) {
+    size_t count = 0;
+    ScIterator3Ptr const iter3 = m_ctx->Iterator3(ScType::Unknown, edgeType, m_target);
+    while (iter3->Next())
+      ++count;
+    return count;
+  };
+
+  EXPECT_EQ(countOutput(ScType::EdgeDCommon), 1u);
+  EXPECT_EQ(countOutput(ScType::EdgeAccessConstPosPerm), 11u);
+  EXPECT_EQ(countOutput(ScType::EdgeAccessConstNegPerm), 0u);
+  EXPECT_EQ(countOutput(ScType::Unknown), 12u);
+  EXPECT_EQ(countInput(ScType::EdgeDCommon), 1u);
+  EXPECT_EQ(countInput(ScType::EdgeAccess), 1u);
+
+  EXPECT_TRUE(m_ctx->EraseElement(relationEdge));
+  EXPECT_TRUE(m_ctx->EraseElement(edges.front()));
+
+  EXPECT_EQ(countOutput(ScType::EdgeDCommon), 0u);
+  EXPECT_EQ(countOutput(ScType::EdgeAccessConstPosPerm), 10u);
+  EXPECT_EQ(countOutput(ScType::Unknown), 10u);
+  EXPECT_EQ(countInput(ScType::EdgeDCommon), 0u);
+}
+
+TEST_F(ScIterator3Test, NextBatch)
+{
+  for (size_t i = 0; i < 150; ++i)
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_source, m_ctx->CreateNode(ScType::NodeConst));
+
+  std::vector<ScAddrTriple> expected;
+  ScIterator3Ptr iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  while (iter3->Next())
+    expected.push_back(iter3->Get());
+  EXPECT_EQ(expected.size(), 151u);
+
+  std::vector<ScAddrTriple> results(100);
+  iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  EXPECT_EQ(iter3->NextBatch(results.data(), results.size()), 100u);
+  EXPECT_EQ(iter3->NextBatch(results.data(), 0), 0u);
+
+  std::vector<ScAddrTriple> rest(100);
+  EXPECT_EQ(iter3->NextBatch(rest.data(), rest.size()), 51u);
+  EXPECT_EQ(iter3->NextBatch(rest.data(), rest.size()), 0u);
+
+  results.insert(results.end(), rest.begin(), rest.begin() + 51);
+  EXPECT_EQ(results, expected);
+}
+
+TEST_F(ScIterator3Test, Iterate3)
+{
+  for (size_t i = 0; i < 10; ++i)
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_source, m_ctx->CreateNode(ScType::NodeConst));
+
+  std::vector<ScAddrTriple> expected;
+  ScIterator3Ptr const iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  while (iter3->Next())
+    expected.push_back(iter3->Get());
+
+  std::vector<ScAddrTriple> results;
+  for (ScAddrTriple const & triple : m_ctx->Iterate3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown))
+  {
+    size_t inputCount = 0;
+    for (ScAddrTriple const & input : m_ctx->Iterate3(ScType::Unknown, ScType::EdgeAccess, triple[2]))
+    {
+      EXPECT_EQ(input[0], m_source);
+      ++inputCount;
+    }
+    EXPECT_EQ(inputCount, 1u);
+
+    results.push_back(triple);
+  }
+  EXPECT_EQ(results.size(), 11u);
+  EXPECT_EQ(results, expected);
+
+  ScIterator3Range invalidIter3 = m_ctx->Iterate3(ScAddr::Empty, ScType::EdgeAccess, ScType::Unknown);
+  EXPECT_FALSE(invalidIter3.IsValid());
+}
+
+TEST_F(ScIterator3Test, ParallelForEachIter3)
+{
+  // more arcs than in one chunk of parallel walk
+  for (size_t i = 0; i < 10000; ++i)
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_source, m_ctx->CreateNode(ScType::NodeConst));
+  m_ctx->CreateEdge(ScType::EdgeDCommonConst, m_source, m_ctx->CreateNode(ScType::NodeConst));
+
+  std::vector<ScAddrTriple> expected;
+  ScIterator3Ptr const iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  while (iter3->Next())
+    expected.push_back(iter3->Get());
+  EXPECT_EQ(expected.size(), 10001u);
+
+  size_t const threadsCount = 4;
+  std::vector<std::vector<ScAddrTriple>> threadResults(threadsCount);
+  size_t const count = m_ctx->ParallelForEachIter3(
+      m_source,
+      ScType::EdgeAccessConstPosPerm,
+      ScType::Unknown,
+      [&threadResults](size_t threadIndex, ScAddr const & source, ScAddr const & edge, ScAddr const & target) {
+        threadResults[threadIndex].push_back({source, edge, target});
+      },
+      threadsCount);
+  EXPECT_EQ(count, expected.size());
+
+  std::vector<ScAddrTriple> results;
+  for (auto const & triples : threadResults)
+    results.insert(results.end(), triples.begin(), triples.end());
+
+  auto const less = [](ScAddrTriple const & a, ScAddrTriple const & b) {
+    return a[1].Hash() < b[1].Hash();
+  };
+  std::sort(results.begin(), results.end(), less);
+  std::sort(expected.begin(), expected.end(), less);
+  EXPECT_EQ(results, expected);
+
+  // iterators without arcs list of fixed element are walked by calling thread
+  size_t inputCount = 0;
+  EXPECT_EQ(
+      m_ctx->ParallelForEachIter3(
+          m_source,
+          ScType::EdgeAccessConstPosPerm,
+          m_target,
+          [&inputCount, this](size_t threadIndex, ScAddr const &, ScAddr const & edge, ScAddr const &) {
+            EXPECT_EQ(threadIndex, 0u);
+            EXPECT_EQ(edge, m_edge);
+            ++inputCount;
+          }),
+      1u);
+  EXPECT_EQ(inputCount, 1u);
+}
+
+TEST_F(ScIterator3Test, Cursor)
+{
+  for (size_t i = 0; i < 9; ++i)
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_source, m_ctx->CreateNode(ScType::NodeConst));
+
+  std::vector<ScAddrTriple> expected;
+  auto iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  while (iter3->Next())
+    expected.push_back(iter3->Get());
+  EXPECT_EQ(expected.size(), 10u);
+
+  // walk by pages of 3 results, each page is got by new iterator
+  std::vector<ScAddrTriple> results;
+  ScIterator3Cursor cursor;
+  bool hasCursor = false;
+  do
+  {
+    iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+    if (hasCursor)
+      EXPECT_TRUE(iter3->Seek(cursor));
+
+    for (size_t i = 0; i < 3 && iter3->Next(); ++i)
+      results.push_back(iter3->Get());
+
+    hasCursor = iter3->GetCursor(cursor);
+  } while (hasCursor && results.size() < expected.size());
+  EXPECT_EQ(results, expected);
+
+  // cursor is invalid, when its arc is erased
+  iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  EXPECT_TRUE(iter3->Next());
+  EXPECT_TRUE(iter3->GetCursor(cursor));
+  EXPECT_TRUE(m_ctx->EraseElement(cursor.arc));
+  iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  EXPECT_FALSE(iter3->Seek(cursor));
+
+  // cursor of another element arcs list isn't accepted
+  iter3 = m_ctx->Iterator3(m_target, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  EXPECT_TRUE(m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown)->Next());
+  auto const sourceIter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  EXPECT_TRUE(sourceIter3->Next());
+  EXPECT_TRUE(sourceIter3->GetCursor(cursor));
+  EXPECT_FALSE(iter3->Seek(cursor));
+
+  // cursor of arc with another end isn't accepted by iterator with both fixed ends
+  ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const edge = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_source, node);
+  cursor = {*edge, *m_source, *node};
+  auto fixedIter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, m_target);
+  EXPECT_FALSE(fixedIter3->Seek(cursor));
+  cursor = {*m_edge, *m_source, *m_target};
+  EXPECT_TRUE(fixedIter3->Seek(cursor));
+}
+
+TEST_F(ScIterator3Test, Reverse)
+{
+  for (size_t i = 0; i < 5; ++i)
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_ctx->CreateNode(ScType::NodeConst), m_target);
+  m_ctx->CreateEdge(ScType::EdgeDCommonConst, m_ctx->CreateNode(ScType::NodeConst), m_target);
+
+  std::vector<ScAddrTriple> expected;
+  auto iter3 = m_ctx->Iterator3(ScType::Unknown, ScType::EdgeAccessConstPosPerm, m_target);
+  while (iter3->Next())
+    expected.push_back(iter3->Get());
+  EXPECT_EQ(expected.size(), 6u);
+  std::reverse(expected.begin(), expected.end());
+  EXPECT_EQ(expected.front()[1], m_edge);
+
+  std::vector<ScAddrTriple> results;
+  iter3 = m_ctx->Iterator3(ScType::Unknown, ScType::EdgeAccessConstPosPerm, m_target);
+  EXPECT_TRUE(iter3->SetReverse());
+  for (size_t i = 0; i < 2 && iter3->Next(); ++i)
+    results.push_back(iter3->Get());
+  EXPECT_FALSE(iter3->SetReverse());
+
+  // reverse walk is resumed by reverse iterator
+  ScIterator3Cursor cursor;
+  EXPECT_TRUE(iter3->GetCursor(cursor));
+  iter3 = m_ctx->Iterator3(ScType::Unknown, ScType::EdgeAccessConstPosPerm, m_target);
+  EXPECT_TRUE(iter3->SetReverse());
+  EXPECT_TRUE(iter3->Seek(cursor));
+  while (iter3->Next())
+    results.push_back(iter3->Get());
+  EXPECT_EQ(results, expected);
+
+  EXPECT_FALSE(m_ctx->Iterator3(m_source, m_edge, m_target)->SetReverse());
+}
+
+TEST_F(ScIterator3Test, ErasedElement)
+{
+  EXPECT_TRUE(m_ctx->EraseElement(m_target));
+
+  EXPECT_FALSE(m_ctx->IsElement(m_target));
+  EXPECT_FALSE(m_ctx->Iterator3(ScType::Unknown, ScType::EdgeAccess, m_target)->IsValid());
+  EXPECT_FALSE(m_ctx->Iterator3(m_source, ScType::EdgeAccess, m_target)->IsValid());
+
+  ScIterator3Ptr const iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccess, ScType::Unknown);
+  EXPECT_TRUE(iter3->IsValid());
+  EXPECT_FALSE(iter3->Next());
+}
+
 TEST_F(ScIterator3Test, a_a_f)
 {
   ScIterator3Ptr const iter3 = m_ctx->Iterator3(sc_type_node, sc_type_arc_pos_const_perm, m_target);
@@ -160,3 +160,34 @@ TEST_F(ScIterator5Test, f_a_f_a_f)
   EXPECT_EQ(iter5->Get(3), m_attrEdge);
   EXPECT_EQ(iter5->Get(4), m_attr);
 }
+
+TEST_F(ScIterator5Test, Iterate5)
+{
+  size_t count = 0;
+  for (ScAddrFiver const & fiver : m_ctx->Iterate5(
+           m_source, ScType::EdgeAccessConstPosPerm, ScType::Unknown, ScType::EdgeAccessConstPosPerm, m_attr))
+  {
+    EXPECT_EQ(fiver[1], m_edge);
+    EXPECT_EQ(fiver[2], m_target);
+    EXPECT_EQ(fiver[3], m_attrEdge);
+    ++count;
+  }
+  EXPECT_EQ(count, 1u);
+
+  // inner iterators are reinitialized in the same storage for each main arc
+  ScAddr const otherTarget = m_ctx->CreateNode(ScType::Const);
+  ScAddr const otherEdge = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_source, otherTarget);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_attr, otherEdge);
+
+  count = 0;
+  m_ctx->ForEachIter5(
+      m_source,
+      ScType::EdgeAccessConstPosPerm,
+      ScType::Unknown,
+      ScType::EdgeAccessConstPosPerm,
+      m_attr,
+      [&count](ScAddr const &, ScAddr const &, ScAddr const &, ScAddr const &, ScAddr const &) {
+        ++count;
+      });
+  EXPECT_EQ(count, 2u);
+}
@@ -3,3 +3,4 @@
 #include "sc_test.hpp"
 
 using ScEventTest = ScMemoryTest;
+using ScOrderedEventTest = ScOrderedEventsMemoryTest;
@@ -7,6 +7,7 @@
 #include "event_test_utils.hpp"
 
 #include <atomic>
+#include <map>
 #include <thread>
 #include <mutex>
 
@@ -192,6 +193,247 @@ TEST_F(ScEventTest, events_lock)
     m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, node, node2);
 }
 
+TEST_F(ScEventTest, SubscribeNeighbourElements)
+{
+  // neighbour sc-elements are in different shards of events table
+  size_t const nodesCount = 256;
+  std::vector<ScAddr> nodes(nodesCount);
+  for (auto & node : nodes)
+    node = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const target = m_ctx->CreateNode(ScType::NodeConst);
+
+  std::atomic_uint eventsCount(0);
+  auto const callback = [&eventsCount](ScAddr const &, ScAddr const &, ScAddr const &)
+  {
+    ++eventsCount;
+    return true;
+  };
+
+  std::vector<std::unique_ptr<ScEventAddOutputEdge>> events;
+  for (size_t i = 0; i < nodesCount; i += 2)
+    events.emplace_back(new ScEventAddOutputEdge(*m_ctx, nodes[i], callback));
+
+  // the second subscription of the same sc-element stays, when the first one is destroyed
+  std::unique_ptr<ScEventAddOutputEdge> evt(new ScEventAddOutputEdge(*m_ctx, nodes[0], callback));
+  evt.reset();
+
+  for (auto const & node : nodes)
+    EXPECT_TRUE(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, node, target).IsValid());
+
+  ScTimer timer(kTestTimeout);
+  while (eventsCount < nodesCount / 2 && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(eventsCount, nodesCount / 2);
+
+  // sc-elements without subscriptions don't emit anything
+  events.clear();
+  for (auto const & node : nodes)
+    EXPECT_TRUE(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, node, target).IsValid());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(eventsCount, nodesCount / 2);
+}
+
+TEST_F(ScEventTest, SubscribeOtherEventTypes)
+{
+  ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const target = m_ctx->CreateNode(ScType::NodeConst);
+
+  std::atomic_uint addCount(0);
+  std::atomic_uint removeCount(0);
+  ScEventRemoveOutputEdge removeEvt(*m_ctx, node,
+    [&removeCount](ScAddr const &, ScAddr const &, ScAddr const &)
+  {
+    ++removeCount;
+    return true;
+  });
+
+  {
+    // subscription of the other type is removed, so arcs creation doesn't emit anything
+    ScEventAddOutputEdge addEvt(*m_ctx, node,
+      [&addCount](ScAddr const &, ScAddr const &, ScAddr const &)
+    {
+      ++addCount;
+      return true;
+    });
+  }
+
+  ScAddr const edge = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, node, target);
+  EXPECT_TRUE(edge.IsValid());
+  EXPECT_TRUE(m_ctx->EraseElement(edge));
+
+  ScTimer timer(kTestTimeout);
+  while (removeCount == 0 && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(addCount, 0u);
+  EXPECT_EQ(removeCount, 1u);
+}
+
+TEST_F(ScEventTest, DestroyWithPendingCalls)
+{
+  size_t const eventsCount = 10000;
+  // pending calls are dropped by workers without callbacks, so destruction is bounded by calls, that are running
+  double const destroyTimeout = 1.0;
+  ScAddr const target = m_ctx->CreateNode(ScType::NodeConst);
+
+  std::atomic_uint callsCount(0);
+  std::vector<std::atomic_uint> nodeCallsCounts(eventsCount);
+  std::vector<ScAddr> nodes(eventsCount);
+  std::vector<std::unique_ptr<ScEventAddOutputEdge>> events;
+  for (size_t i = 0; i < eventsCount; ++i)
+  {
+    nodes[i] = m_ctx->CreateNode(ScType::NodeConst);
+    events.emplace_back(new ScEventAddOutputEdge(*m_ctx, nodes[i],
+      [&callsCount, &nodeCallsCounts, i](ScAddr const &, ScAddr const &, ScAddr const &)
+    {
+      ++nodeCallsCounts[i];
+      ++callsCount;
+      return true;
+    }));
+  }
+
+  for (auto const & node : nodes)
+    EXPECT_TRUE(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, node, target).IsValid());
+
+  // destroying thread is woken by the last pending call of event, so it doesn't wait for more than calls take
+  ScTimer timer;
+  events.clear();
+  EXPECT_LT(timer.Seconds(), destroyTimeout);
+
+  // each call ran once before destruction of its event or was dropped, so none of them runs after it
+  size_t const callsCountAfterDestroy = callsCount;
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(callsCount, callsCountAfterDestroy);
+  EXPECT_LE(callsCountAfterDestroy, eventsCount);
+  for (auto const & nodeCallsCount : nodeCallsCounts)
+    EXPECT_LE(nodeCallsCount, 1u);
+}
+
+TEST_F(ScOrderedEventTest, CallsInOrderOfEmit)
+{
+  size_t const edgesCount = 1000;
+  ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const otherNode = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const target = m_ctx->CreateNode(ScType::NodeConst);
+
+  // calls of one subscription are processed one by one, so they are collected without lock
+  std::atomic_uint activeCount(0);
+  std::atomic_bool isParallel(false);
+  std::atomic_uint callsCount(0);
+  std::vector<ScAddr> calledEdges;
+  ScEventAddOutputEdge evt(*m_ctx, node,
+    [&](ScAddr const &, ScAddr const & edge, ScAddr const &)
+  {
+    if (++activeCount != 1)
+      isParallel = true;
+    calledEdges.push_back(edge);
+    --activeCount;
+    ++callsCount;
+    return true;
+  });
+
+  std::atomic_uint otherCallsCount(0);
+  ScEventAddOutputEdge otherEvt(*m_ctx, otherNode,
+    [&otherCallsCount](ScAddr const &, ScAddr const &, ScAddr const &)
+  {
+    ++otherCallsCount;
+    return true;
+  });
+
+  std::vector<ScAddr> edges;
+  for (size_t i = 0; i < edgesCount; ++i)
+  {
+    edges.push_back(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, node, target));
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, otherNode, target);
+  }
+
+  ScTimer timer(kTestTimeout);
+  while ((callsCount < edgesCount || otherCallsCount < edgesCount) && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_EQ(callsCount, edgesCount);
+  EXPECT_EQ(otherCallsCount, edgesCount);
+  EXPECT_FALSE(isParallel);
+  EXPECT_EQ(calledEdges, edges);
+}
+
+TEST_F(ScEventTest, AddOutputEdgeBatch)
+{
+  size_t const edgesCount = 1000;
+  uint32_t const maxBatchSize = 64;
+  ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const target = m_ctx->CreateNode(ScType::NodeConst);
+
+  std::mutex mutex;
+  std::vector<std::vector<std::pair<ScAddr, ScAddr>>> batches;
+  std::atomic_uint edgesCountInBatches(0);
+  ScEventAddOutputEdge evt(*m_ctx, node,
+    [&](ScAddr const & addr, std::vector<std::pair<ScAddr, ScAddr>> const & edges)
+  {
+    EXPECT_EQ(addr, node);
+    std::lock_guard<std::mutex> lock(mutex);
+    batches.push_back(edges);
+    edgesCountInBatches += edges.size();
+    return true;
+  }, maxBatchSize, 50);
+
+  std::vector<ScAddr> edges;
+  for (size_t i = 0; i < edgesCount; ++i)
+    edges.push_back(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, node, target));
+
+  // the last batch isn't full, so it's delivered, when its delay is expired
+  ScTimer timer(kTestTimeout);
+  while (edgesCountInBatches < edgesCount && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_EQ(edgesCountInBatches, edgesCount);
+  EXPECT_LT(batches.size(), edgesCount);
+
+  // edges of batch are passed in order of their creation
+  std::map<ScAddr, size_t, ScAddrLessFunc> indices;
+  for (size_t i = 0; i < edges.size(); ++i)
+    indices[edges[i]] = i;
+
+  for (auto const & batch : batches)
+  {
+    EXPECT_LE(batch.size(), maxBatchSize);
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+      EXPECT_EQ(batch[i].second, target);
+      if (i > 0)
+        EXPECT_LT(indices[batch[i - 1].first], indices[batch[i].first]);
+    }
+  }
+}
+
+TEST_F(ScEventTest, DestroyWithCollectedBatch)
+{
+  size_t const edgesCount = 10;
+  ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const target = m_ctx->CreateNode(ScType::NodeConst);
+
+  std::atomic_uint edgesCountInBatches(0);
+  {
+    // batch isn't full and its delay is long, so it's delivered by destruction of subscription
+    ScEventAddOutputEdge evt(*m_ctx, node,
+      [&edgesCountInBatches](ScAddr const &, std::vector<std::pair<ScAddr, ScAddr>> const & edges)
+    {
+      edgesCountInBatches += edges.size();
+      return true;
+    }, 1024, 60000);
+
+    for (size_t i = 0; i < edgesCount; ++i)
+      EXPECT_TRUE(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, node, target).IsValid());
+  }
+
+  EXPECT_EQ(edgesCountInBatches, edgesCount);
+}
+
 // TODO: Fix deadlocks in sc-memory
 TEST_F(ScEventTest, DISABLED_pend_events)
 {
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+#include "sc-core/sc-store/sc_segment.h"
+}
+
+class ScSegmentLocksTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_segment = sc_segment_new(1);
+    ASSERT_NE(m_segment, nullptr);
+  }
+
+  void TearDown() override
+  {
+    sc_segment_free(m_segment);
+  }
+
+  sc_segment_section * GetSection(sc_uint32 index) const
+  {
+    return &m_segment->sections[index];
+  }
+
+  sc_segment * m_segment = nullptr;
+};
+
+TEST_F(ScSegmentLocksTest, RecursiveSharedLocks)
+{
+  sc_segment_section * section = GetSection(0);
+  for (size_t i = 0; i < 3; ++i)
+    sc_segment_section_lock_shared(section);
+
+  // section can't be upgraded from shared lock
+  EXPECT_FALSE(sc_segment_section_lock_try(section, 10));
+
+  for (size_t i = 0; i < 3; ++i)
+    sc_segment_section_unlock_shared(section);
+
+  EXPECT_TRUE(sc_segment_section_lock_try(section, 10));
+  sc_segment_section_unlock(section);
+}
+
+TEST_F(ScSegmentLocksTest, SharedLocksOfManySections)
+{
+  sc_uint32 const sectionsCount = sc_segment_get_sections_count();
+  for (sc_uint32 i = 0; i < sectionsCount; ++i)
+    sc_segment_section_lock_shared(GetSection(i));
+
+  // writer waits for readers of the last locked section
+  std::atomic_bool isLocked = false;
+  std::thread writer([this, sectionsCount, &isLocked]() {
+    sc_segment_section * section = GetSection(sectionsCount - 1);
+    sc_segment_section_lock(section);
+    isLocked = true;
+    sc_segment_section_unlock(section);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(isLocked);
+
+  // all shared locks are tracked, so recursive lock doesn't wait for writer
+  for (sc_uint32 i = 0; i < sectionsCount; ++i)
+  {
+    sc_segment_section_lock_shared(GetSection(i));
+    EXPECT_FALSE(sc_segment_section_lock_try(GetSection(i), 10));
+  }
+
+  for (sc_uint32 i = 0; i < sectionsCount; ++i)
+  {
+    sc_segment_section_unlock_shared(GetSection(i));
+    sc_segment_section_unlock_shared(GetSection(i));
+  }
+
+  writer.join();
+  EXPECT_TRUE(isLocked);
+
+  for (sc_uint32 i = 0; i < sectionsCount; ++i)
+  {
+    EXPECT_TRUE(sc_segment_section_lock_try(GetSection(i), 10));
+    sc_segment_section_unlock(GetSection(i));
+  }
+}
+
+TEST_F(ScSegmentLocksTest, ReadersAndWritersContention)
+{
+  size_t const readersCount = 4;
+  size_t const writersCount = 2;
+  size_t const operationsCount = 100000;
+
+  sc_segment_section * section = GetSection(0);
+  volatile sc_uint64 first = 0;
+  volatile sc_uint64 second = 0;
+  std::atomic_bool isConsistent = true;
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < readersCount; ++i)
+  {
+    threads.emplace_back([&]() {
+      for (size_t j = 0; j < operationsCount; ++j)
+      {
+        sc_segment_section_lock_shared(section);
+        sc_segment_section_lock_shared(section);
+        if (first != second)
+          isConsistent = false;
+        sc_segment_section_unlock_shared(section);
+        sc_segment_section_unlock_shared(section);
+      }
+    });
+  }
+
+  for (size_t i = 0; i < writersCount; ++i)
+  {
+    threads.emplace_back([&]() {
+      for (size_t j = 0; j < operationsCount; ++j)
+      {
+        sc_segment_section_lock(section);
+        ++first;
+        ++second;
+        sc_segment_section_unlock(section);
+      }
+    });
+  }
+
+  for (std::thread & thread : threads)
+    thread.join();
+
+  EXPECT_TRUE(isConsistent);
+  EXPECT_EQ(first, writersCount * operationsCount);
+  EXPECT_EQ(second, first);
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+#include "sc-core/sc-store/sc_segment.h"
+#include "sc-core/sc_memory_private.h"
+}
+
+class ScSegmentTest : public testing::Test
+{
+protected:
+  void TearDown() override
+  {
+    for (sc_segment * segment : m_segments)
+      sc_segment_free(segment);
+  }
+
+  sc_segment * NewSegment(sc_addr_seg num)
+  {
+    sc_segment * segment = sc_segment_new(num);
+    EXPECT_NE(segment, nullptr);
+    m_segments.push_back(segment);
+    return segment;
+  }
+
+  //! Locks empty slot of segment and leaves it used. Returns SC_FALSE, if there are no empty slots
+  sc_bool LockEmptySlot(sc_segment * segment, sc_addr_offset & offset)
+  {
+    if (sc_segment_lock_empty_element(&m_ctx, segment, &offset) == nullptr)
+      return SC_FALSE;
+
+    sc_segment_section_unlock(sc_segment_get_section(segment, offset));
+    return SC_TRUE;
+  }
+
+  //! Locks all empty slots of segment and returns their offsets in order of allocation
+  std::vector<sc_addr_offset> LockAllEmptySlots(sc_segment * segment)
+  {
+    std::vector<sc_addr_offset> offsets;
+    sc_addr_offset offset;
+    while (LockEmptySlot(segment, offset))
+      offsets.push_back(offset);
+
+    return offsets;
+  }
+
+  static void EraseSlot(sc_segment * segment, sc_addr_offset offset)
+  {
+    sc_segment_lock_element(segment, offset);
+    sc_segment_erase_element(segment, offset);
+    sc_segment_unlock_element(segment, offset);
+  }
+
+  sc_memory_context m_ctx = {};
+  std::vector<sc_segment *> m_segments;
+};
+
+TEST_F(ScSegmentTest, AllEmptySlotsAreLockedOnce)
+{
+  sc_segment * segment = NewSegment(1);
+  EXPECT_TRUE(sc_segment_has_empty_slot(segment));
+  EXPECT_EQ(sc_segment_get_elements_count(segment), 0u);
+
+  std::vector<sc_addr_offset> const offsets = LockAllEmptySlots(segment);
+  EXPECT_EQ(offsets.size(), size_t(SC_SEGMENT_ELEMENTS_COUNT));
+
+  std::vector<bool> isLocked(SC_SEGMENT_ELEMENTS_COUNT, false);
+  for (sc_addr_offset offset : offsets)
+  {
+    ASSERT_LT(offset, SC_SEGMENT_ELEMENTS_COUNT);
+    EXPECT_FALSE(isLocked[offset]);
+    isLocked[offset] = true;
+  }
+
+  EXPECT_FALSE(sc_segment_has_empty_slot(segment));
+  EXPECT_EQ(sc_segment_get_elements_count(segment), sc_uint32(SC_SEGMENT_ELEMENTS_COUNT));
+}
+
+TEST_F(ScSegmentTest, EmptyAddrIsNotLocked)
+{
+  sc_segment * segment = NewSegment(0);
+
+  std::vector<sc_addr_offset> const offsets = LockAllEmptySlots(segment);
+  EXPECT_EQ(offsets.size(), size_t(SC_SEGMENT_ELEMENTS_COUNT - 1));
+  for (sc_addr_offset offset : offsets)
+    EXPECT_NE(offset, 0u);
+
+  EXPECT_FALSE(sc_segment_has_empty_slot(segment));
+}
+
+TEST_F(ScSegmentTest, ErasedSlotsAreReused)
+{
+  sc_segment * segment = NewSegment(1);
+  std::vector<sc_addr_offset> const offsets = LockAllEmptySlots(segment);
+  ASSERT_EQ(offsets.size(), size_t(SC_SEGMENT_ELEMENTS_COUNT));
+
+  // slots at the bounds of bitmap words and segment
+  std::vector<sc_addr_offset> const erased = {0, 63, 64, SC_SEGMENT_ELEMENTS_COUNT / 2, SC_SEGMENT_ELEMENTS_COUNT - 1};
+  for (sc_addr_offset offset : erased)
+    EraseSlot(segment, offset);
+
+  EXPECT_TRUE(sc_segment_has_empty_slot(segment));
+  EXPECT_EQ(sc_segment_get_elements_count(segment), sc_uint32(SC_SEGMENT_ELEMENTS_COUNT - erased.size()));
+
+  std::vector<bool> isReused(SC_SEGMENT_ELEMENTS_COUNT, false);
+  for (sc_addr_offset offset : LockAllEmptySlots(segment))
+    isReused[offset] = true;
+
+  for (sc_addr_offset offset : erased)
+    EXPECT_TRUE(isReused[offset]);
+  EXPECT_FALSE(sc_segment_has_empty_slot(segment));
+}
+
+TEST_F(ScSegmentTest, LoadedSegmentHasOnlyEmptySlotsInBitmap)
+{
+  sc_segment * segment = NewSegment(0);
+  sc_addr_offset const deleted = 3;
+  for (sc_uint32 offset = 2; offset < SC_SEGMENT_ELEMENTS_COUNT; offset += 2)
+    segment->elements[offset].flags.type = sc_type_node;
+  segment->elements[deleted].flags.type = sc_type_node | sc_flag_request_deletion;
+
+  sc_segment_loaded(segment);
+  sc_uint32 const usedCount = SC_SEGMENT_ELEMENTS_COUNT / 2;
+  EXPECT_EQ(sc_segment_get_elements_count(segment), usedCount);
+
+  // the empty addr and used slots are not empty, erased sc-element is recycled
+  std::vector<sc_addr_offset> const offsets = LockAllEmptySlots(segment);
+  EXPECT_EQ(offsets.size(), size_t(SC_SEGMENT_ELEMENTS_COUNT - 1 - usedCount));
+  bool isDeletedReused = false;
+  for (sc_addr_offset offset : offsets)
+  {
+    EXPECT_EQ(offset % 2u, 1u);
+    EXPECT_EQ(segment->elements[offset].flags.type, 0u);
+    isDeletedReused |= offset == deleted;
+  }
+  EXPECT_TRUE(isDeletedReused);
+}
+
+TEST_F(ScSegmentTest, MemoryOfEmptySegmentIsReleased)
+{
+  sc_segment * segment = NewSegment(1);
+  sc_addr_offset offset;
+  ASSERT_TRUE(LockEmptySlot(segment, offset));
+  segment->elements[offset].flags.type = sc_type_node;
+  segment->meta[offset].ref_count = 1;
+
+  EXPECT_FALSE(sc_segment_release_memory(segment));
+
+  EraseSlot(segment, offset);
+  segment->meta[offset].ref_count = 0;
+
+  // segment, that has section locked by another thread, isn't released
+  sc_segment_section * section = sc_segment_get_section(segment, offset);
+  std::atomic_bool isLocked = false;
+  std::atomic_bool isReleaseChecked = false;
+  std::thread locker([section, &isLocked, &isReleaseChecked]() {
+    sc_segment_section_lock(section);
+    isLocked = true;
+    while (!isReleaseChecked)
+      std::this_thread::yield();
+    sc_segment_section_unlock(section);
+  });
+  while (!isLocked)
+    std::this_thread::yield();
+  EXPECT_FALSE(sc_segment_release_memory(segment));
+  isReleaseChecked = true;
+  locker.join();
+
+  EXPECT_TRUE(sc_segment_release_memory(segment));
+
+  // released pages are read back as zeros
+  for (sc_uint32 i = 0; i < SC_SEGMENT_ELEMENTS_COUNT; ++i)
+  {
+    EXPECT_EQ(segment->elements[i].flags.type, 0u);
+    EXPECT_EQ(segment->meta[i].ref_count, 0);
+  }
+
+  // segment stays valid and its slots are allocated again
+  EXPECT_TRUE(sc_segment_has_empty_slot(segment));
+  ASSERT_TRUE(LockEmptySlot(segment, offset));
+  segment->elements[offset].flags.type = sc_type_node;
+  EXPECT_EQ(segment->elements[offset].flags.type, sc_type_node);
+  EXPECT_EQ(sc_segment_get_elements_count(segment), 1u);
+  EXPECT_FALSE(sc_segment_release_memory(segment));
+}
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include "sc-memory/sc_memory.hpp"
+
+#include "sc_test.hpp"
+
+#include <atomic>
+#include <thread>
+
+extern "C"
+{
+#include "sc-core/sc-store/sc_storage.h"
+#include "sc-core/sc-store/sc_element.h"
+}
+
+class ScStorageReclaimTest : public ScMemoryTest
+{
+protected:
+  //! Shuts down sc-memory and loads it again from repo, that was saved
+  void Reload()
+  {
+    m_ctx->Destroy();
+    ScMemoryTest::Shutdown();
+
+    sc_memory_params params;
+    sc_memory_params_clear(&params);
+
+    params.clear = SC_FALSE;
+    params.repo_path = "repo";
+    params.log_level = "Debug";
+
+    ScMemory::LogMute();
+    ScMemory::Initialize(params);
+    ScMemory::LogUnmute();
+
+    m_ctx = std::make_unique<ScMemoryContext>(sc_access_lvl_make_min, "test");
+  }
+
+  static sc_type GetSlotType(ScAddr const & addr)
+  {
+    sc_element_columns columns;
+    sc_storage_read_element_columns(*addr, &columns);
+    return columns.type;
+  }
+};
+
+TEST_F(ScStorageReclaimTest, ErasedElementIsNotLoadedAfterSave)
+{
+  ScAddr const source = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+
+  // iterator, that isn't finished, keeps erased sc-element in its slot, so it is saved
+  ScIterator3Ptr iter3 = m_ctx->Iterator3(source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  EXPECT_TRUE(m_ctx->EraseElement(node));
+  EXPECT_TRUE(m_ctx->Save());
+  EXPECT_NE(GetSlotType(node) & sc_flag_request_deletion, 0);
+  iter3.reset();
+
+  Reload();
+
+  EXPECT_TRUE(m_ctx->IsElement(source));
+  EXPECT_FALSE(m_ctx->IsElement(node));
+  EXPECT_EQ(GetSlotType(node), 0);
+}
+
+TEST_F(ScStorageReclaimTest, EraseWhileIteratorIsOpen)
+{
+  size_t const count = 2 * SC_STORAGE_RECLAIM_THRESHOLD;
+  ScAddr const source = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddrVector targets;
+  ScAddrVector edges;
+  for (size_t i = 0; i < count; ++i)
+  {
+    targets.push_back(m_ctx->CreateNode(ScType::NodeConst));
+    edges.push_back(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, source, targets.back()));
+  }
+
+  ScIterator3Ptr iter3 = m_ctx->Iterator3(source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  EXPECT_TRUE(iter3->Next());
+
+  for (ScAddr const & target : targets)
+    EXPECT_TRUE(m_ctx->EraseElement(target));
+
+  // slots of erased sc-elements aren't reused, while iterator can read them
+  for (size_t i = 0; i < count; ++i)
+  {
+    ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+    EXPECT_TRUE(std::find(targets.cbegin(), targets.cend(), node) == targets.cend());
+    EXPECT_TRUE(std::find(edges.cbegin(), edges.cend(), node) == edges.cend());
+    EXPECT_NE(GetSlotType(targets[i]) & sc_flag_request_deletion, 0);
+    EXPECT_NE(GetSlotType(edges[i]) & sc_flag_request_deletion, 0);
+  }
+
+  while (iter3->Next())
+    EXPECT_EQ(iter3->Get(0), source);
+}
+
+TEST_F(ScStorageReclaimTest, SlotsAreRecycledAfterIteratorDestroy)
+{
+  size_t const count = 2 * SC_STORAGE_RECLAIM_THRESHOLD;
+  ScAddr const source = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddrVector targets;
+  for (size_t i = 0; i < count; ++i)
+  {
+    targets.push_back(m_ctx->CreateNode(ScType::NodeConst));
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, source, targets.back());
+  }
+
+  ScIterator3Ptr iter3 = m_ctx->Iterator3(source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  EXPECT_TRUE(iter3->Next());
+  for (ScAddr const & target : targets)
+    EXPECT_TRUE(m_ctx->EraseElement(target));
+
+  for (ScAddr const & target : targets)
+    EXPECT_NE(GetSlotType(target) & sc_flag_request_deletion, 0);
+
+  iter3.reset();
+
+  for (ScAddr const & target : targets)
+    EXPECT_EQ(GetSlotType(target), 0);
+  EXPECT_FALSE(m_ctx->Iterator3(source, ScType::EdgeAccessConstPosPerm, ScType::Unknown)->Next());
+}
+
+TEST_F(ScStorageReclaimTest, ConcurrentEraseAndIterate)
+{
+  size_t const readersCount = 4;
+  size_t const roundsCount = 100;
+  size_t const count = 2 * SC_STORAGE_RECLAIM_THRESHOLD;
+  ScAddr const source = m_ctx->CreateNode(ScType::NodeConst);
+
+  std::atomic_bool isStopped = false;
+  std::vector<std::thread> readers;
+  for (size_t i = 0; i < readersCount; ++i)
+  {
+    readers.emplace_back([&source, &isStopped]() {
+      ScMemoryContext ctx(sc_access_lvl_make_min, "reader");
+      while (!isStopped)
+      {
+        ScIterator3Ptr const iter3 = ctx.Iterator3(source, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+        while (iter3->Next())
+          EXPECT_EQ(iter3->Get(0), source);
+      }
+    });
+  }
+
+  ScAddrVector targets(count);
+  for (size_t round = 0; round < roundsCount; ++round)
+  {
+    for (ScAddr & target : targets)
+    {
+      target = m_ctx->CreateNode(ScType::NodeConst);
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, source, target);
+    }
+
+    for (ScAddr const & target : targets)
+      EXPECT_TRUE(m_ctx->EraseElement(target));
+  }
+
+  isStopped = true;
+  for (std::thread & reader : readers)
+    reader.join();
+
+  EXPECT_FALSE(m_ctx->Iterator3(source, ScType::EdgeAccessConstPosPerm, ScType::Unknown)->Next());
+}
+
+TEST_F(ScStorageReclaimTest, ConcurrentRefAndUnrefWithErase)
+{
+  size_t const holdersCount = 4;
+  size_t const roundsCount = 50;
+  size_t const count = 2 * SC_STORAGE_RECLAIM_THRESHOLD;
+
+  ScAddrVector nodes(count);
+  for (size_t round = 0; round < roundsCount; ++round)
+  {
+    for (ScAddr & node : nodes)
+      node = m_ctx->CreateNode(ScType::NodeConst);
+
+    // each holder references sc-elements before erase, so they are alive until holder unreferences them
+    for (size_t i = 0; i < holdersCount; ++i)
+    {
+      for (ScAddr const & node : nodes)
+        sc_storage_element_ref(*node);
+    }
+
+    std::atomic_bool isAlive = true;
+    std::vector<std::thread> holders;
+    for (size_t i = 0; i < holdersCount; ++i)
+    {
+      holders.emplace_back([&nodes, &isAlive]() {
+        for (size_t j = 0; j < 10; ++j)
+        {
+          for (ScAddr const & node : nodes)
+          {
+            sc_storage_element_ref(*node);
+            if (GetSlotType(node) == 0)
+              isAlive = false;
+            sc_storage_element_unref(*node);
+          }
+        }
+
+        for (ScAddr const & node : nodes)
+          sc_storage_element_unref(*node);
+      });
+    }
+
+    for (ScAddr const & node : nodes)
+      EXPECT_TRUE(m_ctx->EraseElement(node));
+
+    for (std::thread & holder : holders)
+      holder.join();
+
+    // referenced sc-elements weren't freed, and the last unreference retired them, so they aren't leaked
+    EXPECT_TRUE(isAlive);
+    sc_storage_reclaim_elements(SC_TRUE);
+    for (ScAddr const & node : nodes)
+    {
+      EXPECT_FALSE(m_ctx->IsElement(node));
+      EXPECT_EQ(GetSlotType(node), 0);
+    }
+  }
+}
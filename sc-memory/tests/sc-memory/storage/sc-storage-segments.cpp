@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "sc-memory/sc_memory.hpp"
+
+#include "sc_test.hpp"
+
+#include <algorithm>
+#include <thread>
+
+extern "C"
+{
+#include "sc-core/sc-store/sc_storage.h"
+}
+
+class ScStorageSegmentsTest : public ScMemoryTest
+{
+protected:
+  static bool AreUnique(ScAddrVector addrs)
+  {
+    std::sort(addrs.begin(), addrs.end(), [](ScAddr const & a, ScAddr const & b) {
+      return a.Hash() < b.Hash();
+    });
+    return std::adjacent_find(addrs.cbegin(), addrs.cend()) == addrs.cend();
+  }
+};
+
+TEST_F(ScStorageSegmentsTest, ElementsAreAllocatedAcrossSegments)
+{
+  size_t const count = SC_SEGMENT_ELEMENTS_COUNT + SC_SEGMENT_ELEMENTS_COUNT / 2;
+  sc_uint32 const segmentsCount = sc_storage_get_segments_count();
+
+  ScAddrVector nodes(count);
+  for (ScAddr & node : nodes)
+    node = m_ctx->CreateNode(ScType::NodeConst);
+
+  sc_uint32 const allocatedSegmentsCount = sc_storage_get_segments_count();
+  EXPECT_GE(allocatedSegmentsCount, segmentsCount + 1);
+  EXPECT_TRUE(AreUnique(nodes));
+  for (ScAddr const & node : nodes)
+    EXPECT_TRUE(m_ctx->IsElement(node));
+
+  for (ScAddr const & node : nodes)
+    EXPECT_TRUE(m_ctx->EraseElement(node));
+  sc_storage_reclaim_elements(SC_TRUE);
+
+  // slots of erased sc-elements are reused, so new segments aren't allocated
+  for (ScAddr & node : nodes)
+    node = m_ctx->CreateNode(ScType::NodeConst);
+
+  EXPECT_EQ(sc_storage_get_segments_count(), allocatedSegmentsCount);
+  EXPECT_TRUE(AreUnique(nodes));
+  for (ScAddr const & node : nodes)
+    EXPECT_TRUE(m_ctx->IsElement(node));
+}
+
+TEST_F(ScStorageSegmentsTest, ConcurrentAllocationAcrossSegments)
+{
+  size_t const threadsCount = 4;
+  size_t const count = SC_SEGMENT_ELEMENTS_COUNT / 2;
+
+  std::vector<ScAddrVector> nodes(threadsCount, ScAddrVector(count));
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threadsCount; ++i)
+  {
+    threads.emplace_back([&threadNodes = nodes[i]]() {
+      ScMemoryContext ctx(sc_access_lvl_make_min, "allocator");
+      for (ScAddr & node : threadNodes)
+        node = ctx.CreateNode(ScType::NodeConst);
+    });
+  }
+
+  for (std::thread & thread : threads)
+    thread.join();
+
+  ScAddrVector allNodes;
+  for (ScAddrVector const & threadNodes : nodes)
+    allNodes.insert(allNodes.end(), threadNodes.cbegin(), threadNodes.cend());
+
+  EXPECT_GE(sc_storage_get_segments_count(), 2u);
+  EXPECT_TRUE(AreUnique(allNodes));
+  for (ScAddr const & node : allNodes)
+    EXPECT_TRUE(m_ctx->IsElement(node));
+}
@@ -29,6 +29,16 @@ configure_file(
     "${CMAKE_CURRENT_LIST_DIR}/fs-storage/test_defines.hpp"
 )
 
+make_tests_from_folder(${CMAKE_CURRENT_LIST_DIR}/storage
+    NAME sc-memory-storage-tests
+    DEPENDS sc-memory sc-core ${GLIB2_LIBRARIES}
+    INCLUDES ${SC_MEMORY_SRC} ${CMAKE_CURRENT_LIST_DIR}/_test ${GLIB2_INCLUDE_DIRS}
+)
+
+if(${SC_CLANG_FORMAT_CODE})
+    target_clangformat_setup(sc-memory-storage-tests)
+endif()
+
 make_tests_from_folder(${CMAKE_CURRENT_LIST_DIR}/agents
     NAME sc-memory-agents-tests
     DEPENDS sc-memory
@@ -123,8 +123,11 @@ public:
 
     m_memoryParams.max_loaded_segments = GetIntByKey("max_loaded_segments", DEFAULT_MAX_LOADED_SEGMENTS);
     m_memoryParams.max_threads = GetIntByKey("max_threads", DEFAULT_MAX_THREADS);
+    m_memoryParams.concurrency_level = GetIntByKey("concurrency_level", DEFAULT_CONCURRENCY_LEVEL);
     m_memoryParams.max_events_and_agents_threads =
         GetIntByKey("max_events_and_agents_threads", DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS);
+    m_memoryParams.ordered_events_delivery =
+        GetBoolByKey("ordered_events_delivery", DEFAULT_ORDERED_EVENTS_DELIVERY);
 
     m_memoryParams.save_period = GetIntByKey("save_period", DEFAULT_SAVE_PERIOD);
     m_memoryParams.update_period = GetIntByKey("update_period", DEFAULT_UPDATE_PERIOD);
@@ -19,33 +19,85 @@ public:
       ScMemoryJsonPayload & errorsPayload) override
   {
     ScMemoryJsonPayload responsePayload;
+    ScAddrVector createdAddrs(requestPayload.size());
 
-    auto const & resolveAddr = [&responsePayload](ScMemoryJsonPayload const & json) -> ScAddr {
+    // nodes don't depend on other elements, so all of them are created at once
+    std::vector<size_t> nodesIndices;
+    std::vector<ScType> nodesTypes;
+    for (size_t i = 0; i < requestPayload.size(); ++i)
+    {
+      if (requestPayload[i]["el"].get<std::string>() == "node")
+      {
+        nodesIndices.push_back(i);
+        nodesTypes.emplace_back(requestPayload[i]["type"].get<size_t>());
+      }
+    }
+
+    ScAddrVector const & nodes = context->CreateNodes(nodesTypes);
+    for (size_t i = 0; i < nodes.size(); ++i)
+      createdAddrs[nodesIndices[i]] = nodes[i];
+
+    // sequential edges are created at once, until any of them refers to edge that isn't created yet
+    std::vector<size_t> edgesIndices;
+    std::vector<ScType> edgesTypes;
+    ScAddrVector edgesSources;
+    ScAddrVector edgesTargets;
+    auto const & createEdges = [&]() {
+      ScAddrVector const & edges = context->CreateEdges(edgesTypes, edgesSources, edgesTargets);
+      for (size_t i = 0; i < edges.size(); ++i)
+        createdAddrs[edgesIndices[i]] = edges[i];
+
+      edgesIndices.clear();
+      edgesTypes.clear();
+      edgesSources.clear();
+      edgesTargets.clear();
+    };
+
+    // edge can refer only to element, that is before it in request
+    auto const & resolveAddr = [&](ScMemoryJsonPayload const & json, size_t edgeIndex) -> ScAddr {
       ScMemoryJsonPayload const & sub = json["value"];
       if (json["type"].get<std::string>() == "ref")
-        return ScAddr(responsePayload[sub.get<size_t>()].get<size_t>());
+      {
+        size_t const index = sub.get<size_t>();
+        if (index >= edgeIndex)
+          SC_THROW_EXCEPTION(
+              utils::ExceptionInvalidParams,
+              "Edge " << edgeIndex << " refers to element " << index << ", that isn't created before it");
+
+        if (!edgesIndices.empty() && index >= edgesIndices.front())
+          createEdges();
+
+        ScAddr const & addr = createdAddrs[index];
+        if (!addr.IsValid())
+          SC_THROW_EXCEPTION(
+              utils::ExceptionInvalidParams,
+              "Edge " << edgeIndex << " refers to element " << index << ", that isn't valid");
+
+        return addr;
+      }
 
       return ScAddr(sub.get<size_t>());
     };
 
-    for (auto & atom : requestPayload)
+    for (size_t i = 0; i < requestPayload.size(); ++i)
     {
+      auto & atom = requestPayload[i];
       std::string const & element = atom["el"].get<std::string>();
       ScType const & type = ScType(atom["type"].get<size_t>());
 
-      ScAddr created;
-      if (element == "node")
-        created = context->CreateNode(type);
-      else if (element == "edge")
+      if (element == "edge")
       {
-        ScAddr const & src = resolveAddr(atom["src"]);
-        ScAddr const & trg = resolveAddr(atom["trg"]);
+        ScAddr const & src = resolveAddr(atom["src"], i);
+        ScAddr const & trg = resolveAddr(atom["trg"], i);
 
-        created = context->CreateEdge(type, src, trg);
+        edgesIndices.push_back(i);
+        edgesTypes.push_back(type);
+        edgesSources.push_back(src);
+        edgesTargets.push_back(trg);
       }
       else if (element == "link")
       {
-        created = context->CreateLink(type);
+        ScAddr const & created = context->CreateLink(type);
         ScLink link{*context, created};
 
         auto const & content = atom["content"];
@@ -55,10 +107,14 @@ public:
           link.Set(content.get<sc_int>());
         else if (content.is_number_float())
           link.Set(content.get<float>());
+
+        createdAddrs[i] = created;
       }
+    }
+    createEdges();
 
+    for (ScAddr const & created : createdAddrs)
       responsePayload.push_back(created.Hash());
-    }
 
     if (responsePayload.is_null())
       return "{}"_json;
@@ -16,11 +16,12 @@ public:
       ScMemoryJsonPayload requestPayload,
       ScMemoryJsonPayload & errorsPayload) override
   {
+    ScAddrVector addrs;
+    addrs.reserve(requestPayload.size());
     for (auto & hash : requestPayload)
-    {
-      ScAddr const addr{hash.get<size_t>()};
-      context->EraseElement(addr);
-    }
+      addrs.emplace_back(hash.get<size_t>());
+
+    context->EraseElements(addrs);
 
     return {SC_TRUE};
   }
@@ -13,5 +13,6 @@
 #include "sc_memory_delete_elements_json_action.hpp"
 #include "sc_memory_handle_link_content_json_action.hpp"
 #include "sc_memory_handle_keynodes_json_action.hpp"
+#include "sc_memory_search_neighbours_json_action.hpp"
 #include "sc_memory_template_generate_json_action.hpp"
 #include "sc_memory_template_search_json_action.hpp"
@@ -38,5 +38,6 @@ private:
       {"search_template", new ScMemoryTemplateSearchJsonAction()},
       {"generate_template", new ScMemoryTemplateGenerateJsonAction()},
       {"content", new ScMemoryHandleLinkContentJsonAction()},
+      {"search_neighbours", new ScMemorySearchNeighboursJsonAction()},
   };
 };
@@ -0,0 +1,70 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_json_action.hpp"
+
+/*! Lists triples of output or input arcs of sc-element by pages. Response contains cursor of the last triple, that is
+ * passed in request of the next page, so each page is found without walk of previous ones.
+ */
+class ScMemorySearchNeighboursJsonAction : public ScMemoryJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    ScAddr const addr{requestPayload["addr"].get<size_t>()};
+    ScType const edgeType{requestPayload.value("edgeType", size_t(0))};
+    bool const isOutput = requestPayload.value("direction", std::string("output")) == "output";
+    size_t const count = requestPayload["count"].get<size_t>();
+
+    if (isOutput)
+      return SearchNeighbours(context->Iterator3(addr, edgeType, ScType::Unknown), requestPayload, count);
+
+    return SearchNeighbours(context->Iterator3(ScType::Unknown, edgeType, addr), requestPayload, count);
+  }
+
+private:
+  //! Cursor is supported by 3-element iterators only, so they are passed with their own types
+  template <typename IteratorPtrType>
+  ScMemoryJsonPayload SearchNeighbours(
+      IteratorPtrType const & iter3,
+      ScMemoryJsonPayload & requestPayload,
+      size_t const count)
+  {
+    if (!iter3->IsValid())
+      SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Neighbours of invalid element can't be searched");
+
+    if (requestPayload.value("reverse", false))
+      iter3->SetReverse();
+
+    auto const & cursorPayload = requestPayload.find("cursor");
+    if (cursorPayload != requestPayload.end() && !cursorPayload->is_null())
+    {
+      ScIterator3Cursor cursor;
+      cursor.arc = *ScAddr((*cursorPayload)[0].get<size_t>());
+      cursor.begin = *ScAddr((*cursorPayload)[1].get<size_t>());
+      cursor.end = *ScAddr((*cursorPayload)[2].get<size_t>());
+      if (!iter3->Seek(cursor))
+        SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Cursor is not valid, its arc was erased");
+    }
+
+    std::vector<std::vector<size_t>> triples;
+    while (triples.size() < count && iter3->Next())
+      triples.push_back({iter3->Get(0).Hash(), iter3->Get(1).Hash(), iter3->Get(2).Hash()});
+
+    // the next page is requested with cursor, until there are no more triples
+    ScMemoryJsonPayload responseCursor;
+    ScIterator3Cursor cursor;
+    if (triples.size() == count && iter3->GetCursor(cursor))
+      responseCursor = {ScAddr(cursor.arc).Hash(), ScAddr(cursor.begin).Hash(), ScAddr(cursor.end).Hash()};
+
+    return {{"triples", triples}, {"cursor", responseCursor}};
+  }
+};
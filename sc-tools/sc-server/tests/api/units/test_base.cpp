@@ -121,6 +121,49 @@ TEST_F(ScServerTest, CreateEmptyElements)
   client.Stop();
 }
 
+TEST_F(ScServerTest, CreateElementsWithForwardRef)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "create_elements",
+      ScMemoryJsonPayload::array({
+          {
+              {"el", "node"},
+              {"type", sc_type_node | sc_type_const},
+          },
+          {
+              {"el", "edge"},
+              {"src",
+               {
+                   {"type", "ref"},
+                   {"value", 0},
+               }},
+              {"trg",
+               {
+                   {"type", "ref"},
+                   {"value", 2},
+               }},
+              {"type", sc_type_arc_pos_const_perm},
+          },
+          {
+              {"el", "node"},
+              {"type", sc_type_node | sc_type_const},
+          },
+      }));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+  EXPECT_FALSE(response["errors"][0]["message"].is_null());
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, CreateElementsBySCs)
 {
   ScClient client;
@@ -945,6 +988,57 @@ TEST_F(ScServerTest, GenerateTemplateByAddr)
   client.Stop();
 }
 
+TEST_F(ScServerTest, SearchNeighbours)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & src = m_ctx->CreateNode(ScType::NodeConst);
+  std::vector<size_t> edges;
+  for (size_t i = 0; i < 5; ++i)
+  {
+    ScAddr const & trg = m_ctx->CreateNode(ScType::NodeConst);
+    edges.push_back(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, src, trg).Hash());
+  }
+
+  // pages of 2 triples are requested with cursor of previous page in order of edges creation
+  std::vector<size_t> foundEdges;
+  ScMemoryJsonPayload cursor;
+  do
+  {
+    std::string const payloadString = ScMemoryJsonConverter::From(
+        0,
+        "search_neighbours",
+        {
+            {"addr", src.Hash()},
+            {"direction", "output"},
+            {"edgeType", sc_type_arc_pos_const_perm},
+            {"count", 2},
+            {"reverse", true},
+            {"cursor", cursor},
+        });
+    EXPECT_TRUE(client.Send(payloadString));
+
+    auto const response = client.GetResponseMessage();
+    EXPECT_FALSE(response.is_null());
+    EXPECT_TRUE(response["status"].get<sc_bool>());
+    EXPECT_TRUE(response["errors"].empty());
+
+    auto const & responsePayload = response["payload"];
+    for (auto const & triple : responsePayload["triples"])
+    {
+      EXPECT_EQ(triple[0].get<size_t>(), src.Hash());
+      foundEdges.push_back(triple[1].get<size_t>());
+    }
+    cursor = responsePayload["cursor"];
+  } while (!cursor.is_null());
+
+  EXPECT_EQ(foundEdges, edges);
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, HandleEvents)
 {
   ScClient client;
@@ -4,7 +4,8 @@ set -eo pipefail
 
 pip3 install --user -r requirements.txt
 
-cmake -B build -DSC_FILE_MEMORY=${FILE_MEMORY} -DCMAKE_BUILD_TYPE=${BUILD_TYPE} -DSC_COVERAGE=${COVERAGE} -DSC_AUTO_TEST=ON -DSC_BUILD_TESTS=ON
+cmake -B build -DSC_FILE_MEMORY=${FILE_MEMORY} -DCMAKE_BUILD_TYPE=${BUILD_TYPE} -DSC_COVERAGE=${COVERAGE} -DSC_AUTO_TEST=ON -DSC_BUILD_TESTS=ON \
+  -DSC_SEGMENT_COLUMNS=${SEGMENT_COLUMNS:-OFF} -DSC_ARC_TYPE_INDEX=${ARC_TYPE_INDEX:-OFF} -DSC_ARC_HASH_INDEX=${ARC_HASH_INDEX:-OFF}
 echo ::group::Make
 cmake --build build -j$(nproc)
 echo ::endgroup::